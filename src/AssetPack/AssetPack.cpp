@@ -0,0 +1,205 @@
+#include <SDL2/SDL.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "AssetPack.h"
+
+AssetPack gAssetPack;
+
+// Initialize member variables
+AssetPack::AssetPack()
+{
+  mData = NULL;
+  mSize = 0;
+}
+
+AssetPack::~AssetPack()
+{
+  close();
+}
+
+// Map an archive written by write() and index its files
+bool AssetPack::open( std::string path )
+{
+  close();
+
+  int fd = ::open( path.c_str(), O_RDONLY );
+  if( fd < 0 )
+  {
+    return false;
+  }
+
+  struct stat info;
+  if( fstat( fd, &info ) < 0 || info.st_size < (off_t)( 2 * sizeof( Uint32 ) ) )
+  {
+    ::close( fd );
+    printf( "Error: Asset pack %s is empty!\n", path.c_str() );
+    return false;
+  }
+
+  void* data = mmap( NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+  ::close( fd );
+  if( data == MAP_FAILED )
+  {
+    printf( "Error: Could not map asset pack %s!\n", path.c_str() );
+    return false;
+  }
+
+  mData = (Uint8*)data;
+  mSize = info.st_size;
+
+  Uint32 magic = 0;
+  Uint32 count = 0;
+  memcpy( &magic, mData, sizeof( Uint32 ) );
+  memcpy( &count, mData + sizeof( Uint32 ), sizeof( Uint32 ) );
+
+  size_t tableEnd = 2 * sizeof( Uint32 ) + (size_t)count * sizeof( PackEntry );
+  if( magic != MAGIC || tableEnd > mSize )
+  {
+    printf( "Error: %s is not an asset pack!\n", path.c_str() );
+    close();
+    return false;
+  }
+
+  for( Uint32 i = 0; i < count; i++ )
+  {
+    PackEntry entry;
+    memcpy( &entry, mData + 2 * sizeof( Uint32 ) + i * sizeof( PackEntry ), sizeof( PackEntry ) );
+
+    if( entry.name[ ASSET_NAME_LENGTH - 1 ] != '\0' || (size_t)entry.offset + entry.size > mSize )
+    {
+      printf( "Error: Asset pack %s is damaged!\n", path.c_str() );
+      close();
+      return false;
+    }
+
+    mEntries[ entry.name ] = entry;
+  }
+
+  return true;
+}
+
+// Unmap the archive. Anything still reading from it must be freed first.
+void AssetPack::close()
+{
+  if( mData != NULL )
+  {
+    munmap( mData, mSize );
+    mData = NULL;
+    mSize = 0;
+  }
+
+  mEntries.clear();
+}
+
+bool AssetPack::isOpen()
+{
+  return mData != NULL;
+}
+
+// Read-only stream over a file in the archive, or over the loose file on disk
+SDL_RWops* AssetPack::openFile( std::string path )
+{
+  std::map<std::string, PackEntry>::iterator it = mEntries.find( path );
+  if( it != mEntries.end() )
+  {
+    return SDL_RWFromConstMem( mData + it->second.offset, it->second.size );
+  }
+
+  return SDL_RWFromFile( path.c_str(), "rb" );
+}
+
+// Pack files into a new archive: a file count, a table of names, offsets and
+// sizes, then the contents of each file aligned to 16 bytes
+bool AssetPack::write( std::string path, std::vector<std::string>& files )
+{
+  std::vector<PackEntry> entries( files.size() );
+  std::vector<std::vector<Uint8> > contents( files.size() );
+  Uint32 offset = 2 * sizeof( Uint32 ) + files.size() * sizeof( PackEntry );
+
+  for( size_t i = 0; i < files.size(); i++ )
+  {
+    if( files[ i ].size() >= ASSET_NAME_LENGTH )
+    {
+      printf( "Error: Asset name %s is too long!\n", files[ i ].c_str() );
+      return false;
+    }
+
+    FILE* file = fopen( files[ i ].c_str(), "rb" );
+    if( file == NULL )
+    {
+      printf( "Error: Could not open %s!\n", files[ i ].c_str() );
+      return false;
+    }
+
+    fseek( file, 0, SEEK_END );
+    long size = ftell( file );
+    fseek( file, 0, SEEK_SET );
+
+    contents[ i ].resize( size );
+    if( size > 0 && fread( &contents[ i ][ 0 ], size, 1, file ) != 1 )
+    {
+      printf( "Error: Could not read %s!\n", files[ i ].c_str() );
+      fclose( file );
+      return false;
+    }
+    fclose( file );
+
+    offset = ( offset + 15 ) & ~15u;
+
+    memset( &entries[ i ], 0, sizeof( PackEntry ) );
+    strcpy( entries[ i ].name, files[ i ].c_str() );
+    entries[ i ].offset = offset;
+    entries[ i ].size = size;
+
+    offset += size;
+  }
+
+  FILE* pack = fopen( path.c_str(), "wb" );
+  if( pack == NULL )
+  {
+    printf( "Error: Could not create %s!\n", path.c_str() );
+    return false;
+  }
+
+  Uint32 magic = MAGIC;
+  Uint32 count = files.size();
+  fwrite( &magic, sizeof( Uint32 ), 1, pack );
+  fwrite( &count, sizeof( Uint32 ), 1, pack );
+  if( count > 0 )
+  {
+    fwrite( &entries[ 0 ], sizeof( PackEntry ), count, pack );
+  }
+
+  for( size_t i = 0; i < files.size(); i++ )
+  {
+    // Pad up to where the table says the file starts
+    while( ftell( pack ) < (long)entries[ i ].offset )
+    {
+      fputc( 0, pack );
+    }
+
+    if( contents[ i ].size() > 0 )
+    {
+      fwrite( &contents[ i ][ 0 ], contents[ i ].size(), 1, pack );
+    }
+  }
+
+  bool success = ferror( pack ) == 0;
+  if( fclose( pack ) != 0 || !success )
+  {
+    printf( "Error: Could not write %s!\n", path.c_str() );
+    return false;
+  }
+
+  return true;
+}
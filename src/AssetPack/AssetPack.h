@@ -0,0 +1,37 @@
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+#include <SDL2/SDL.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../globals/globals.h"
+
+// Every asset file in one archive mapped into memory, read in place through
+// SDL_RWops. Files missing from the archive are opened from disk instead.
+class AssetPack
+{
+  public:
+  AssetPack();
+  ~AssetPack();
+
+  bool open( std::string path );
+  void close();
+  bool isOpen();
+
+  SDL_RWops* openFile( std::string path );
+
+  static bool write( std::string path, std::vector<std::string>& files );
+
+  private:
+  static const Uint32 MAGIC = 0x314B5054; // "TPK1"
+
+  Uint8* mData;
+  size_t mSize;
+  std::map<std::string, PackEntry> mEntries;
+};
+
+extern AssetPack gAssetPack;
+
+#endif
@@ -0,0 +1,204 @@
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+#include <stdio.h>
+
+#include "../constants.h"
+#include "AudioDevice.h"
+
+AudioDevice gAudioDevice;
+
+// Initialize member variables
+AudioDevice::AudioDevice()
+{
+  mBufferSamples = 0;
+  mFrequency = MIX_DEFAULT_FREQUENCY;
+  mFrameBytes = 4;
+  mChecks = 0;
+  mGrowPending = false;
+
+  mLastMix = 0;
+  mSkipMixes = 0;
+  SDL_AtomicSet( &mMixPeriod, 0 );
+  SDL_AtomicSet( &mMixSamples, 0 );
+  SDL_AtomicSet( &mRecentUnderruns, 0 );
+  SDL_AtomicSet( &mUnderruns, 0 );
+  SDL_AtomicSet( &mInputDelay, 0 );
+}
+
+// Open the mixer with a buffer of the given number of sample frames.
+// Sound effects loaded afterwards are converted to the device format once,
+// so mixing them is a plain copy.
+bool AudioDevice::open( int bufferSamples )
+{
+  if( bufferSamples < 64 || bufferSamples > AUDIO_MAX_BUFFER_SAMPLES )
+  {
+    bufferSamples = AUDIO_BUFFER_SAMPLES;
+  }
+
+  if( Mix_OpenAudio( MIX_DEFAULT_FREQUENCY, MIX_DEFAULT_FORMAT, 2, bufferSamples ) < 0 )
+  {
+    printf( "SDL_mixer could not initializae! SDL_mixer Error: %s\n", Mix_GetError() );
+    return false;
+  }
+
+  int frequency = MIX_DEFAULT_FREQUENCY;
+  Uint16 format = MIX_DEFAULT_FORMAT;
+  int channels = 2;
+  Mix_QuerySpec( &frequency, &format, &channels );
+
+  mBufferSamples = bufferSamples;
+  mFrequency = frequency;
+  mFrameBytes = channels * SDL_AUDIO_BITSIZE( format ) / 8;
+  mChecks = 0;
+
+  // The first callbacks run while the device is still starting up
+  mLastMix = 0;
+  mSkipMixes = 8;
+  SDL_AtomicSet( &mMixPeriod, 0 );
+  SDL_AtomicSet( &mMixSamples, bufferSamples );
+  SDL_AtomicSet( &mRecentUnderruns, 0 );
+
+  Mix_SetPostMix( postMix, this );
+
+  return true;
+}
+
+void AudioDevice::close()
+{
+  if( mBufferSamples > 0 )
+  {
+    Mix_SetPostMix( NULL, NULL );
+    Mix_CloseAudio();
+    mBufferSamples = 0;
+  }
+}
+
+// Note a device that keeps running dry, so grow() raises the buffer later.
+// Called once per logic step, forgetting stray late callbacks every few seconds.
+void AudioDevice::checkUnderruns()
+{
+  if( mBufferSamples == 0 || mGrowPending )
+  {
+    return;
+  }
+
+  if( SDL_AtomicGet( &mRecentUnderruns ) >= AUDIO_UNDERRUN_LIMIT && mBufferSamples < AUDIO_MAX_BUFFER_SAMPLES )
+  {
+    printf( "Audio device underran, raising buffer to %d samples at the next menu\n", mBufferSamples * 2 );
+    mGrowPending = true;
+    return;
+  }
+
+  mChecks++;
+  if( mChecks >= AUDIO_UNDERRUN_WINDOW )
+  {
+    mChecks = 0;
+    SDL_AtomicSet( &mRecentUnderruns, 0 );
+  }
+}
+
+bool AudioDevice::isGrowPending()
+{
+  return mGrowPending;
+}
+
+// Reopen the device with twice the buffer if it ran dry. Reopening stops
+// every voice and the music stream, and nothing may be loading through the
+// mixer while it is closed, so the caller picks a quiet moment. Returns
+// whether the device was reopened, at the larger size or else the old one.
+bool AudioDevice::grow()
+{
+  if( !mGrowPending || mBufferSamples == 0 )
+  {
+    return false;
+  }
+
+  mGrowPending = false;
+  int previousSamples = mBufferSamples;
+  int bufferSamples = mBufferSamples * 2;
+  if( bufferSamples > AUDIO_MAX_BUFFER_SAMPLES )
+  {
+    bufferSamples = AUDIO_MAX_BUFFER_SAMPLES;
+  }
+
+  // Chunks and music stay valid since the device is reopened with the same format
+  close();
+  if( open( bufferSamples ) )
+  {
+    printf( "Audio buffer raised to %d samples\n", bufferSamples );
+    return true;
+  }
+
+  printf( "Keeping the audio buffer at %d samples\n", previousSamples );
+  return open( previousSamples );
+}
+
+// Track how long key presses wait before the logic sees them
+void AudioDevice::noteInput( Uint32 timestamp )
+{
+  int delay = (int)( SDL_GetTicks() - timestamp );
+  if( delay < 0 || delay > 1000 )
+  {
+    return;
+  }
+  delay *= 1000;
+
+  int smoothed = SDL_AtomicGet( &mInputDelay );
+  SDL_AtomicSet( &mInputDelay, smoothed + ( delay - smoothed ) / 8 );
+}
+
+int AudioDevice::getBufferSamples()
+{
+  return mBufferSamples;
+}
+
+// Late mixer callbacks since the device was first opened
+int AudioDevice::getUnderruns()
+{
+  return SDL_AtomicGet( &mUnderruns );
+}
+
+// Estimated ms from a key press to its sound leaving the device: the wait for
+// the logic step, the wait for the next mix, then one buffer played out
+float AudioDevice::getLatency()
+{
+  float buffer = 1000.0f * SDL_AtomicGet( &mMixSamples ) / mFrequency;
+  float period = SDL_AtomicGet( &mMixPeriod ) / 1000.0f;
+  if( period <= 0.0f )
+  {
+    period = buffer;
+  }
+
+  return ( SDL_AtomicGet( &mInputDelay ) / 1000.0f ) + ( period / 2 ) + buffer;
+}
+
+// Runs on the audio thread after every mix, timing the callbacks
+void AudioDevice::postMix( void* data, Uint8* stream, int len )
+{
+  AudioDevice* device = (AudioDevice*)data;
+  Uint64 now = SDL_GetPerformanceCounter();
+
+  if( device->mSkipMixes > 0 )
+  {
+    device->mSkipMixes--;
+  }
+  else if( device->mLastMix != 0 )
+  {
+    int samples = len / device->mFrameBytes;
+    int period = (int)( ( now - device->mLastMix ) * 1000000 / SDL_GetPerformanceFrequency() );
+    int expected = (int)( (Uint64)samples * 1000000 / device->mFrequency );
+
+    // Waiting more than two buffers means the device ran out of sound
+    if( period > 2 * expected )
+    {
+      SDL_AtomicIncRef( &device->mRecentUnderruns );
+      SDL_AtomicIncRef( &device->mUnderruns );
+    }
+
+    int smoothed = SDL_AtomicGet( &device->mMixPeriod );
+    SDL_AtomicSet( &device->mMixPeriod, smoothed == 0 ? period : smoothed + ( period - smoothed ) / 16 );
+    SDL_AtomicSet( &device->mMixSamples, samples );
+  }
+
+  device->mLastMix = now;
+}
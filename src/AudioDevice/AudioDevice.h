@@ -0,0 +1,48 @@
+#ifndef AUDIODEVICE_H
+#define AUDIODEVICE_H
+
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+
+// The mixer's output device, watched for late callbacks and how long sound takes to be heard
+class AudioDevice
+{
+  public:
+  AudioDevice();
+
+  bool open( int bufferSamples );
+  void close();
+  void checkUnderruns();
+  bool isGrowPending();
+  bool grow();
+  void noteInput( Uint32 timestamp );
+
+  int getBufferSamples();
+  int getUnderruns();
+  float getLatency();
+
+  private:
+  static void postMix( void* data, Uint8* stream, int len );
+
+  int mBufferSamples;
+  int mFrequency;
+  int mFrameBytes;
+  int mChecks;
+  bool mGrowPending;
+
+  // Written by the mixer callback
+  Uint64 mLastMix;
+  int mSkipMixes;
+  SDL_atomic_t mMixPeriod;
+  SDL_atomic_t mMixSamples;
+  SDL_atomic_t mRecentUnderruns;
+  SDL_atomic_t mUnderruns;
+
+  // Smoothed time from a key press to the logic step handling it, in microseconds
+  SDL_atomic_t mInputDelay;
+};
+
+extern AudioDevice gAudioDevice;
+
+#endif
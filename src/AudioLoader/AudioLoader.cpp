@@ -0,0 +1,207 @@
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+#include <stdio.h>
+#include <string>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../AssetPack/AssetPack.h"
+#include "AudioLoader.h"
+
+AudioLoader gAudioLoader;
+
+// Initialize member variables
+AudioLoader::AudioLoader()
+{
+  mThread = NULL;
+
+  for( int i = 0; i < AUDIO_ASSET_TOTAL; i++ )
+  {
+    SDL_AtomicSet( &mStates[ i ], AUDIO_LOAD_PENDING );
+  }
+}
+
+// Begin loading every asset in the background, or right here without threads
+bool AudioLoader::start()
+{
+  mThread = SDL_CreateThread( run, "AudioLoader", this );
+  if( mThread == NULL )
+  {
+    printf( "Could not create audio loader thread! SDL Error: %s\n", SDL_GetError() );
+    return run( this ) == 0;
+  }
+
+  return true;
+}
+
+// Wait for the worker to finish before the assets are freed
+void AudioLoader::wait()
+{
+  if( mThread != NULL )
+  {
+    SDL_WaitThread( mThread, NULL );
+    mThread = NULL;
+  }
+}
+
+// Whether an asset has finished loading, successfully or not
+bool AudioLoader::isReady( AudioAsset asset )
+{
+  return SDL_AtomicGet( &mStates[ asset ] ) != AUDIO_LOAD_PENDING;
+}
+
+// Whether every sound effect used during play has finished loading
+bool AudioLoader::hasEssentials()
+{
+  for( int i = AUDIO_ASSET_MOVE; i <= AUDIO_ASSET_TETRIS; i++ )
+  {
+    if( !isReady( (AudioAsset)i ) )
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Whether every asset has finished loading, so the worker no longer uses the mixer
+bool AudioLoader::isFinished()
+{
+  for( int i = 0; i < AUDIO_ASSET_TOTAL; i++ )
+  {
+    if( !isReady( (AudioAsset)i ) )
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Worker entry point loading assets in the order they are needed
+int AudioLoader::run( void* data )
+{
+  AudioLoader* loader = (AudioLoader*)data;
+  int failures = 0;
+
+  for( int i = 0; i < AUDIO_ASSET_TOTAL; i++ )
+  {
+    bool loaded = loader->load( (AudioAsset)i );
+    if( !loaded )
+    {
+      failures++;
+    }
+
+    // Publishing the state also publishes the global set by load
+    SDL_AtomicSet( &loader->mStates[ i ], loaded ? AUDIO_LOAD_READY : AUDIO_LOAD_FAILED );
+  }
+
+  return failures;
+}
+
+// Open a music track to be decoded as it plays, preferring its compressed copy
+Mix_Music* AudioLoader::loadMusic( std::string name )
+{
+  Mix_Music* music = Mix_LoadMUS_RW( gAssetPack.openFile( name + ".ogg" ), 1 );
+  if( music == NULL )
+  {
+    music = Mix_LoadMUS_RW( gAssetPack.openFile( name + ".wav" ), 1 );
+  }
+
+  return music;
+}
+
+// Load one asset into its global
+bool AudioLoader::load( AudioAsset asset )
+{
+  bool success = true;
+
+  switch( asset )
+  {
+    case AUDIO_ASSET_START_MUSIC:
+      gStartMusic = loadMusic( "music/start" );
+      if( gStartMusic == NULL )
+      {
+	printf( "Failed to load start music! SDL_mixer Error: %s\n", Mix_GetError() );
+	success = false;
+      }
+      break;
+
+    case AUDIO_ASSET_MOVE:
+      gMoveSound = Mix_LoadWAV_RW( gAssetPack.openFile( "sounds/move.wav" ), 1 );
+      if( gMoveSound == NULL )
+      {
+	printf( "Failed to load move sound! SDL_mixer Error: %s\n", Mix_GetError() );
+	success = false;
+      }
+      break;
+
+    case AUDIO_ASSET_HOLD:
+      gHoldSound = Mix_LoadWAV_RW( gAssetPack.openFile( "sounds/hold.wav" ), 1 );
+      if( gHoldSound == NULL )
+      {
+	printf( "Failed to load hold sound! SDL_mixer Error: %s\n", Mix_GetError() );
+	success = false;
+      }
+      break;
+
+    case AUDIO_ASSET_LAND:
+      gLandSound = Mix_LoadWAV_RW( gAssetPack.openFile( "sounds/land.wav" ), 1 );
+      if( gLandSound == NULL )
+      {
+	printf( "Failed to load land sound! SDL_Mixer Error: %s\n", Mix_GetError() );
+	success = false;
+      }
+      break;
+
+    case AUDIO_ASSET_CLEAR:
+      gClearSound = Mix_LoadWAV_RW( gAssetPack.openFile( "sounds/clear.wav" ), 1 );
+      if( gClearSound == NULL )
+      {
+	printf( "Failed to load clear sound! SDL_mixer Error: %s\n", Mix_GetError() );
+	success = false;
+      }
+      break;
+
+    case AUDIO_ASSET_TETRIS:
+      gTetrisSound = Mix_LoadWAV_RW( gAssetPack.openFile( "sounds/tetris.wav" ), 1 );
+      if( gTetrisSound == NULL )
+      {
+	printf( "Failed to load tetris sound! SDL_mixer Error: %s\n", Mix_GetError() );
+	success = false;
+      }
+      break;
+
+    case AUDIO_ASSET_SCORE_MUSIC:
+      gScoreMusic = loadMusic( "music/score" );
+      if( gScoreMusic == NULL )
+      {
+	printf( "Failed to load score music! SDL_mixer Error: %s\n", Mix_GetError() );
+	success = false;
+      }
+      break;
+
+    case AUDIO_ASSET_GAMEOVER_MUSIC:
+      gGameOverMusic = loadMusic( "sounds/gameover" );
+      if( gGameOverMusic == NULL )
+      {
+	printf( "Failed to load game over music! SDL_mixer Error: %s\n", Mix_GetError() );
+	success = false;
+      }
+      break;
+
+    default:
+      {
+	int i = asset - AUDIO_ASSET_BGM;
+	gBGMusic[ i ] = loadMusic( "music/bgm" + std::to_string( i + 1 ) );
+	if( gBGMusic[ i ] == NULL )
+	{
+	  printf( "Failed to load background music %d! SDL_mixer Error: %s\n", i + 1, Mix_GetError() );
+	  success = false;
+	}
+      }
+      break;
+  }
+
+  return success;
+}
@@ -0,0 +1,36 @@
+#ifndef AUDIOLOADER_H
+#define AUDIOLOADER_H
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+#include <string>
+
+#include "../constants.h"
+
+// Loads sounds and music on a worker thread while the intro plays.
+// Each asset's global is set before it is marked ready, so a sound still
+// loading is a NULL chunk that SDL_mixer refuses to play.
+class AudioLoader
+{
+  public:
+  AudioLoader();
+
+  bool start();
+  void wait();
+
+  bool isReady( AudioAsset asset );
+  bool hasEssentials();
+  bool isFinished();
+
+  private:
+  static int run( void* data );
+  static Mix_Music* loadMusic( std::string name );
+  bool load( AudioAsset asset );
+
+  SDL_Thread* mThread;
+  SDL_atomic_t mStates[ AUDIO_ASSET_TOTAL ];
+};
+
+extern AudioLoader gAudioLoader;
+
+#endif
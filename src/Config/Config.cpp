@@ -0,0 +1,93 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <map>
+#include <string>
+
+#include "../IOWorker/IOWorker.h"
+#include "Config.h"
+
+Config::Config()
+{
+  mPath = "";
+}
+
+// Read settings from a file, which does not have to exist yet
+bool Config::load( std::string path )
+{
+  mPath = path;
+  mValues.clear();
+
+  FILE* file = fopen( path.c_str(), "r" );
+  if( file == NULL )
+  {
+    return false;
+  }
+
+  char line[ 256 ];
+  while( fgets( line, sizeof( line ), file ) != NULL )
+  {
+    std::string entry = line;
+    size_t end = entry.find_last_not_of( "\r\n" );
+    entry = end == std::string::npos ? "" : entry.substr( 0, end + 1 );
+
+    size_t split = entry.find( '=' );
+    if( entry.empty() || entry[ 0 ] == '#' || split == std::string::npos )
+    {
+      continue;
+    }
+
+    mValues[ entry.substr( 0, split ) ] = entry.substr( split + 1 );
+  }
+
+  fclose( file );
+
+  return true;
+}
+
+// Queue every setting to be written back to the file it was loaded from
+bool Config::save()
+{
+  std::string text;
+  for( std::map<std::string, std::string>::iterator it = mValues.begin(); it != mValues.end(); ++it )
+  {
+    text += it->first + "=" + it->second + "\n";
+  }
+
+  if( !gIOWorker.replace( mPath, NULL, 0, text.data(), text.size() ) )
+  {
+    printf( "Could not save settings to %s!\n", mPath.c_str() );
+    return false;
+  }
+
+  return true;
+}
+
+bool Config::has( std::string key )
+{
+  return mValues.find( key ) != mValues.end();
+}
+
+std::string Config::getString( std::string key, std::string fallback )
+{
+  std::map<std::string, std::string>::iterator it = mValues.find( key );
+
+  return it == mValues.end() ? fallback : it->second;
+}
+
+int Config::getInt( std::string key, int fallback )
+{
+  std::map<std::string, std::string>::iterator it = mValues.find( key );
+
+  return it == mValues.end() ? fallback : atoi( it->second.c_str() );
+}
+
+void Config::setString( std::string key, std::string value )
+{
+  mValues[ key ] = value;
+}
+
+void Config::setInt( std::string key, int value )
+{
+  mValues[ key ] = std::to_string( value );
+}
@@ -0,0 +1,27 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#include <map>
+#include <string>
+
+// Settings kept between launches as key=value lines in a text file
+class Config
+{
+  public:
+  Config();
+
+  bool load( std::string path );
+  bool save();
+
+  bool has( std::string key );
+  std::string getString( std::string key, std::string fallback );
+  int getInt( std::string key, int fallback );
+  void setString( std::string key, std::string value );
+  void setInt( std::string key, int value );
+
+  private:
+  std::string mPath;
+  std::map<std::string, std::string> mValues;
+};
+
+#endif
@@ -0,0 +1,231 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../LTexture/LTexture.h"
+#include "DecodePool.h"
+
+DecodePool gDecodePool;
+
+// Initialize member variables, one worker per spare core
+DecodePool::DecodePool()
+{
+  mCollected = 0;
+  mThreadCount = 0;
+  mMutex = NULL;
+  mJobDone = NULL;
+  mMaxSize.x = 0;
+  mMaxSize.y = 0;
+  mFormat = SDL_PIXELFORMAT_ARGB8888;
+  mStartTime = 0;
+  mReporting = false;
+  SDL_AtomicSet( &mNextJob, 0 );
+
+  setThreads( SDL_GetCPUCount() - 1 );
+}
+
+// Stop any workers still running
+DecodePool::~DecodePool()
+{
+  finish();
+}
+
+// Set how many workers decode the next batch, 0 decodes on the caller's thread
+void DecodePool::setThreads( int threads )
+{
+  if( threads < 0 )
+  {
+    threads = 0;
+  }
+  else if( threads > MAX_DECODE_THREADS )
+  {
+    threads = MAX_DECODE_THREADS;
+  }
+
+  mThreadsWanted = threads;
+}
+
+int DecodePool::getThreads()
+{
+  return mThreadsWanted;
+}
+
+// Print each batch's load time to standard error when it finishes
+void DecodePool::setReporting( bool reporting )
+{
+  mReporting = reporting;
+}
+
+// Queue an image for the next batch, returning its job number
+int DecodePool::add( std::string path )
+{
+  DecodedImage image;
+  image.surface = NULL;
+  image.width = 0;
+  image.height = 0;
+  image.scale = 1.0f;
+  image.decodeStart = 0;
+  image.decodeTime = 0;
+
+  mPaths.push_back( path );
+  mImages.push_back( image );
+
+  return mPaths.size() - 1;
+}
+
+// Begin decoding every queued image
+void DecodePool::start()
+{
+  mStartTime = SDL_GetPerformanceCounter();
+  mCollected = 0;
+  mDone.clear();
+  SDL_AtomicSet( &mNextJob, 0 );
+
+  // The renderer is only asked about its limits here, on the render thread
+  mMaxSize = LTexture::getMaxTextureSize();
+  mFormat = LTexture::getTextureFormat();
+
+  mThreadCount = 0;
+  if( mThreadsWanted == 0 )
+  {
+    return;
+  }
+
+  mMutex = SDL_CreateMutex();
+  mJobDone = SDL_CreateCond();
+  if( mMutex == NULL || mJobDone == NULL )
+  {
+    printf( "Could not create decode pool lock! SDL Error: %s\n", SDL_GetError() );
+    return;
+  }
+
+  for( int i = 0; i < mThreadsWanted && i < (int)mPaths.size(); i++ )
+  {
+    mThreads[ mThreadCount ] = SDL_CreateThread( run, "DecodePool", this );
+    if( mThreads[ mThreadCount ] == NULL )
+    {
+      printf( "Could not create decode thread! SDL Error: %s\n", SDL_GetError() );
+      break;
+    }
+
+    mThreadCount++;
+  }
+}
+
+// Job number of the next finished image, or -1 once every image was handed out
+int DecodePool::next()
+{
+  if( mCollected == (int)mPaths.size() )
+  {
+    return -1;
+  }
+
+  // Without workers, decode the next image right here
+  if( mThreadCount == 0 )
+  {
+    LTexture::decode( mPaths[ mCollected ], mMaxSize, mFormat, mImages[ mCollected ] );
+    return mCollected++;
+  }
+
+  SDL_LockMutex( mMutex );
+  while( (int)mDone.size() == mCollected )
+  {
+    SDL_CondWait( mJobDone, mMutex );
+  }
+  int done = mDone[ mCollected++ ];
+  SDL_UnlockMutex( mMutex );
+
+  return done;
+}
+
+DecodedImage& DecodePool::getImage( int job )
+{
+  return mImages[ job ];
+}
+
+std::string DecodePool::getPath( int job )
+{
+  return mPaths[ job ];
+}
+
+// Wait for the workers, report how long the batch took, and forget it
+void DecodePool::finish()
+{
+  for( int i = 0; i < mThreadCount; i++ )
+  {
+    SDL_WaitThread( mThreads[ i ], NULL );
+  }
+
+  if( !mPaths.empty() )
+  {
+    // Decode time added up over every image is what loading them one after another costs
+    Uint64 serial = 0;
+    for( unsigned int i = 0; i < mImages.size(); i++ )
+    {
+      serial += mImages[ i ].decodeTime;
+
+      if( mImages[ i ].surface != NULL )
+      {
+	SDL_FreeSurface( mImages[ i ].surface );
+      }
+    }
+
+    if( mReporting )
+    {
+      float frequency = SDL_GetPerformanceFrequency() / 1000.0f;
+      fprintf( stderr, "Loaded %d images in %.1f ms on %d decode threads, %.1f ms decoding one after another\n", (int)mPaths.size(),
+	       ( SDL_GetPerformanceCounter() - mStartTime ) / frequency, mThreadCount, serial / frequency );
+    }
+  }
+
+  mThreadCount = 0;
+  mPaths.clear();
+  mImages.clear();
+  mDone.clear();
+  mCollected = 0;
+
+  if( mJobDone != NULL )
+  {
+    SDL_DestroyCond( mJobDone );
+    mJobDone = NULL;
+  }
+
+  if( mMutex != NULL )
+  {
+    SDL_DestroyMutex( mMutex );
+    mMutex = NULL;
+  }
+}
+
+// Worker entry point taking jobs until none are left
+int DecodePool::run( void* data )
+{
+  DecodePool* pool = (DecodePool*)data;
+
+  for( ;; )
+  {
+    int job = SDL_AtomicAdd( &pool->mNextJob, 1 );
+    if( job >= (int)pool->mPaths.size() )
+    {
+      break;
+    }
+
+    pool->decode( job );
+  }
+
+  return 0;
+}
+
+// Decode one image and tell the collector it is ready
+void DecodePool::decode( int job )
+{
+  LTexture::decode( mPaths[ job ], mMaxSize, mFormat, mImages[ job ] );
+
+  SDL_LockMutex( mMutex );
+  mDone.push_back( job );
+  SDL_CondSignal( mJobDone );
+  SDL_UnlockMutex( mMutex );
+}
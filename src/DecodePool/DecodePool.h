@@ -0,0 +1,55 @@
+#ifndef DECODEPOOL_H
+#define DECODEPOOL_H
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+
+// Decodes a batch of images on worker threads. Only uploading a finished
+// surface needs the renderer, so the caller collects images with next()
+// in the order they complete and turns each into a texture right away.
+class DecodePool
+{
+  public:
+  DecodePool();
+  ~DecodePool();
+
+  void setThreads( int threads );
+  int getThreads();
+  void setReporting( bool reporting );
+
+  int add( std::string path );
+  void start();
+  int next();
+  DecodedImage& getImage( int job );
+  std::string getPath( int job );
+  void finish();
+
+  private:
+  static int run( void* data );
+  void decode( int job );
+
+  std::vector<std::string> mPaths;
+  std::vector<DecodedImage> mImages;
+  std::vector<int> mDone;
+  int mCollected;
+
+  bool mReporting;
+  int mThreadsWanted;
+  int mThreadCount;
+  SDL_Thread* mThreads[ MAX_DECODE_THREADS ];
+  SDL_atomic_t mNextJob;
+  SDL_mutex* mMutex;
+  SDL_cond* mJobDone;
+
+  SDL_Point mMaxSize;
+  Uint32 mFormat;
+  Uint64 mStartTime;
+};
+
+extern DecodePool gDecodePool;
+
+#endif
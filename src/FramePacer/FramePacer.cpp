@@ -0,0 +1,159 @@
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+#include "../Timer/Timer.h"
+#include "FramePacer.h"
+
+// Initialize member variables
+FramePacer::FramePacer()
+{
+  mFrequency = SDL_GetPerformanceFrequency();
+  mTicksPerStep = mFrequency / LOGIC_TICKS_PER_SECOND;
+  mFrameStart = 0;
+  mAccumulator = 0;
+  mStepsThisFrame = 0;
+
+  for( int i = 0; i < FRAME_TIME_SAMPLES; i++ )
+  {
+    mFrameTimes[ i ] = 0.0f;
+    mWorkTimes[ i ] = 0.0f;
+  }
+  mSampleIndex = 0;
+
+  setMode( PACING_MODE_VSYNC, DEFAULT_FPS_CAP );
+}
+
+// Select how frames are paced
+void FramePacer::setMode( PacingMode mode, int fpsCap )
+{
+  mMode = mode;
+  mFPSCap = fpsCap > 0 ? fpsCap : DEFAULT_FPS_CAP;
+  mTicksPerFrame = mFrequency / mFPSCap;
+}
+
+// Access pacing mode
+PacingMode FramePacer::getMode()
+{
+  return mMode;
+}
+
+// Access frame rate cap
+int FramePacer::getFPSCap()
+{
+  return mFPSCap;
+}
+
+// Measure the last frame and bank its time for logic steps
+void FramePacer::beginFrame()
+{
+  Uint64 now = SDL_GetPerformanceCounter();
+
+  if( mFrameStart != 0 )
+  {
+    Uint64 elapsed = now - mFrameStart;
+    mFrameTimes[ mSampleIndex ] = 1000.0f * elapsed / mFrequency;
+    mSampleIndex = ( mSampleIndex + 1 ) % FRAME_TIME_SAMPLES;
+    mAccumulator += elapsed;
+  }
+  else
+  {
+    mAccumulator = mTicksPerStep;
+  }
+
+  mFrameStart = now;
+  mStepsThisFrame = 0;
+}
+
+// Returns true while a logic step is due this frame
+bool FramePacer::stepLogic()
+{
+  if( mAccumulator < mTicksPerStep )
+  {
+    return false;
+  }
+
+  // Drop time the logic can no longer catch up on
+  if( mStepsThisFrame >= MAX_LOGIC_STEPS_PER_FRAME )
+  {
+    mAccumulator %= mTicksPerStep;
+    return false;
+  }
+
+  mAccumulator -= mTicksPerStep;
+  mStepsThisFrame++;
+  Timer::advanceClock();
+
+  return true;
+}
+
+// Record work time and wait out the rest of a capped frame
+void FramePacer::endFrame()
+{
+  Uint64 now = SDL_GetPerformanceCounter();
+
+  int last = ( mSampleIndex + FRAME_TIME_SAMPLES - 1 ) % FRAME_TIME_SAMPLES;
+  mWorkTimes[ last ] = 1000.0f * ( now - mFrameStart ) / mFrequency;
+
+  if( mMode == PACING_MODE_CAPPED )
+  {
+    waitUntil( mFrameStart + mTicksPerFrame );
+  }
+}
+
+// Average time between frames in milliseconds
+float FramePacer::getAverageFrameTime()
+{
+  float total = 0.0f;
+
+  for( int i = 0; i < FRAME_TIME_SAMPLES; i++ )
+  {
+    total += mFrameTimes[ i ];
+  }
+
+  return total / FRAME_TIME_SAMPLES;
+}
+
+// Longest time between frames in milliseconds
+float FramePacer::getMaxFrameTime()
+{
+  float max = 0.0f;
+
+  for( int i = 0; i < FRAME_TIME_SAMPLES; i++ )
+  {
+    if( mFrameTimes[ i ] > max )
+    {
+      max = mFrameTimes[ i ];
+    }
+  }
+
+  return max;
+}
+
+// Average time spent on events, logic, and rendering in milliseconds
+float FramePacer::getAverageWorkTime()
+{
+  float total = 0.0f;
+
+  for( int i = 0; i < FRAME_TIME_SAMPLES; i++ )
+  {
+    total += mWorkTimes[ i ];
+  }
+
+  return total / FRAME_TIME_SAMPLES;
+}
+
+// Sleep most of the remaining time, then spin for precision
+void FramePacer::waitUntil( Uint64 target )
+{
+  Uint64 now = SDL_GetPerformanceCounter();
+  Uint64 spinTicks = mFrequency * 2 / 1000;
+
+  if( now + spinTicks < target )
+  {
+    SDL_Delay( (Uint32)( 1000 * ( target - now - spinTicks ) / mFrequency ) );
+  }
+
+  while( SDL_GetPerformanceCounter() < target )
+  {
+  }
+}
@@ -0,0 +1,42 @@
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+
+// Steps game logic at a fixed rate and paces rendered frames
+class FramePacer
+{
+  public:
+  FramePacer();
+
+  void setMode( PacingMode mode, int fpsCap );
+  PacingMode getMode();
+  int getFPSCap();
+
+  void beginFrame();
+  bool stepLogic();
+  void endFrame();
+
+  float getAverageFrameTime();
+  float getMaxFrameTime();
+  float getAverageWorkTime();
+
+  private:
+  void waitUntil( Uint64 target );
+
+  PacingMode mMode;
+  int mFPSCap;
+  Uint64 mFrequency;
+  Uint64 mTicksPerStep;
+  Uint64 mTicksPerFrame;
+  Uint64 mFrameStart;
+  Uint64 mAccumulator;
+  int mStepsThisFrame;
+  float mFrameTimes[ FRAME_TIME_SAMPLES ];
+  float mWorkTimes[ FRAME_TIME_SAMPLES ];
+  int mSampleIndex;
+};
+
+#endif
@@ -1,46 +1,63 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_mixer.h>
 #include <stdio.h>
-#include <string>
 
 #include "../constants.h"
 #include "../globals/globals.h"
-#include "../LTexture/LTexture.h"
-#include "../textures/textures.h"
 #include "../Timer/Timer.h"
 #include "../Square/Square.h"
 #include "../GameState/GameState.h"
+#include "../AudioLoader/AudioLoader.h"
+#include "../MusicController/MusicController.h"
+#include "../ScoreStore/ScoreStore.h"
 #include "../functions/functions.h"
 #include "GameOver.h"
 
-GameOver::GameOver( Stats* stats, Square* gridSquares, SDL_Rect& yourScoreArea )
+GameOver::GameOver( Stats* stats, Square* gridSquares )
 {
+  mStats = stats;
   mGridSquares = gridSquares;
+  mLastBG = 0;
+  mScore = 0;
+  mClearedSquares = 0;
 
-  randomPermutation( mSquareSequence, TOTAL_SQUARES );
+  mNextState = GAME_STATE_NULL;
+}
 
-  mLastBG = stats->currentBG;
+GameOver::~GameOver()
+{
+  mStats = NULL;
+  mGridSquares = NULL;
+}
 
-  SDL_Color yourScoreColor = { 233, 82, 82 };
-  std::string yourScore = std::to_string( stats->score );
-  gYourScoreTextTexture.loadFromRenderedText( yourScore.c_str(), yourScoreColor );
+// Begin dissolving the final board. The order is drawn from the game's seeded
+// random numbers, so it stays here where replays expect it.
+void GameOver::enter()
+{
+  randomPermutation( mSquareSequence, TOTAL_SQUARES );
+  mClearedSquares = 0;
 
-  SDL_Point yourScoreCenter;
-  yourScoreCenter.x = yourScoreArea.x + ( yourScoreArea.w / 2 );
-  yourScoreCenter.y = yourScoreArea.y + ( yourScoreArea.h / 2 );
-  mYourScorePosition.x = yourScoreCenter.x - ( gYourScoreTextTexture.getWidth() / 2 );
-  mYourScorePosition.y = yourScoreCenter.y - ( gYourScoreTextTexture.getHeight() / 2 );
+  // One Square disappears every 20 ms, in the order of the permutation
+  for( int i = 0; i < TOTAL_SQUARES; i++ )
+  {
+    mClearTimes[ mSquareSequence[ i ] ] = i * 20;
+  }
+
+  mLastBG = mStats->currentBG;
+  mScore = mStats->score;
 
   mNextState = GAME_STATE_NULL;
 
   mTimer.start();
 
-  Mix_PlayChannel( MIX_CHANNEL_GAMEOVER, gGameOverSound, 0 );
-}
+  // Sound effects still ringing die away with the board
+  Mix_FadeOutChannel( -1, 7000 );
 
-GameOver::~GameOver()
-{
-  mGridSquares = NULL;
+  // Takes over the music stream from the background music
+  if( gAudioLoader.isReady( AUDIO_ASSET_GAMEOVER_MUSIC ) )
+  {
+    gMusicController.request( gGameOverMusic, 0, 0, 0 );
+  }
 }
 
 void GameOver::handleEvent( SDL_Event& e )
@@ -50,62 +67,37 @@ void GameOver::handleEvent( SDL_Event& e )
 
 void GameOver::logic()
 {
-  if( mTimer.getTicks() >= 7000 )
+  int currentTicks = mTimer.getTicks();
+
+  // Clear a random Square every 20 ms
+  while( mClearedSquares < TOTAL_SQUARES && mClearedSquares <= currentTicks / 20 )
   {
-    mNextState = GAME_STATE_SCORELIST;
+    mGridSquares[ mSquareSequence[ mClearedSquares ] ].clear();
+    mClearedSquares++;
   }
 
-  if( Mix_Playing( -1 ) > 0 )
+  if( currentTicks >= 7000 )
   {
-    Mix_FadeOutChannel( -1, 7000 );
+    mNextState = GAME_STATE_SCORELIST;
   }
+
+  // The game over theme only starts on the first step, so it is faded from here
+  gMusicController.fadeOut( 7000 );
 }
 
-void GameOver::render()
+void GameOver::snapshot( FrameSnapshot& s )
 {
-  int currentTicks = mTimer.getTicks();
+  s.ticks = mTimer.getTicks();
+  s.stats.currentBG = mLastBG;
+  s.stats.score = mScore;
 
-  if( currentTicks < 4000 )
-  {
-    gBGTextures[ mLastBG ].setAlpha( 255 - ( 255 * currentTicks / 4000 ) );
-    gBGTextures[ mLastBG ].render( 0, 0 );
-    gPlayBGTexture.setAlpha( 255 - ( 255 * currentTicks / 4000 ) );
-    gPlayBGTexture.render( 0, 0 );
-
-    mGridSquares[ mSquareSequence[ currentTicks / 20 ] ].clear();
-    
-    for( int i = ( 2 * TOTAL_COLS ); i < TOTAL_SQUARES; i++ )
-    {
-      if( mGridSquares[ i ].getState() != SQUARE_STATE_BLANK )
-      {
-	mGridSquares[ i ].render();
-      }
-    }
-  }
+  // The score list that follows is rendered while the board dissolves
+  gScoreStore.getTop( s.scores, TOTAL_SCORES );
 
-  gBlankBGTexture.render( 0, 0 );
-  
-  if( currentTicks < 3000 || currentTicks >= 7000 )
-  {
-    gGameOverTexture.setAlpha( 0 );
-    gYourScoreTextTexture.setAlpha( 0 );
-  }
-  else if( currentTicks >= 3000 && currentTicks < 4000 )
-  {
-    gGameOverTexture.setAlpha( 255 * ( currentTicks - 3000 ) / 1000 );
-    gYourScoreTextTexture.setAlpha( 255 * ( currentTicks - 3000 ) / 1000 );
-  }
-  else if( currentTicks >= 6000 )
-  {
-    gGameOverTexture.setAlpha( 255 - ( 255 * ( currentTicks - 6000 ) / 1000 ) );
-    gYourScoreTextTexture.setAlpha( 255 - ( 255 * ( currentTicks - 6000 ) / 1000 ) );
-  }
-  else
+  snapshotGrid( s, mGridSquares );
+
+  for( int i = 0; i < TOTAL_SQUARES; i++ )
   {
-    gGameOverTexture.setAlpha( 255 );
-    gYourScoreTextTexture.setAlpha( 255 );
+    s.clearTimes[ i ] = mClearTimes[ i ];
   }
-
-  gGameOverTexture.render( 0, 0 );
-  gYourScoreTextTexture.render( mYourScorePosition.x, mYourScorePosition.y );
 }
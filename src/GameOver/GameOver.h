@@ -4,24 +4,29 @@
 #include <SDL2/SDL.h>
 
 #include "../constants.h"
+#include "../globals/globals.h"
 #include "../Square/Square.h"
 #include "../GameState/GameState.h"
 
 class GameOver : public GameState
 {
   public:
-  GameOver( Stats* stats, Square* gridSquares, SDL_Rect& yourScoreArea );
+  GameOver( Stats* stats, Square* gridSquares );
   ~GameOver();
 
+  void enter();
   void handleEvent( SDL_Event& e );
   void logic();
-  void render();
+  void snapshot( FrameSnapshot& s );
 
   private:
+  Stats* mStats;
   Square* mGridSquares;
-  SDL_Point mYourScorePosition;
   int mLastBG;
+  int mScore;
   int mSquareSequence[ TOTAL_SQUARES ];
+  Uint16 mClearTimes[ TOTAL_SQUARES ];
+  int mClearedSquares;
 };
 
 #endif
@@ -0,0 +1,217 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <string>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../LTexture/LTexture.h"
+#include "../textures/textures.h"
+#include "../Square/Square.h"
+#include "../Timeline/Timeline.h"
+#include "../View/View.h"
+#include "GameOverView.h"
+
+// Board fading away, then the game over prompt and score shown for a few seconds
+static const Keyframe BOARD_ALPHA_KEYS[] = { { 0, 255 }, { 4000, 0 } };
+static const Keyframe PROMPT_ALPHA_KEYS[] = { { 3000, 0 }, { 4000, 255 }, { 6000, 255 }, { 7000, 0 } };
+
+GameOverView::GameOverView( Square* gridSquares, SDL_Rect& yourScoreArea )
+{
+  mGridSquares = gridSquares;
+  mYourScoreArea = yourScoreArea;
+
+  mBoardAlphaTrack = mTimeline.addTrack( BOARD_ALPHA_KEYS, 2 );
+  mPromptAlphaTrack = mTimeline.addTrack( PROMPT_ALPHA_KEYS, 4 );
+
+  // Hidden rows above the grid are never drawn
+  mBoardPosition = mGridSquares[ 2 * TOTAL_COLS ].getPosition();
+  mBoardScale = 0.0f;
+
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+  for( int i = 0; i < TOTAL_SQUARES; i++ )
+  {
+    mIndices[ i * 6 ] = i * 4;
+    mIndices[ i * 6 + 1 ] = i * 4 + 1;
+    mIndices[ i * 6 + 2 ] = i * 4 + 2;
+    mIndices[ i * 6 + 3 ] = i * 4 + 2;
+    mIndices[ i * 6 + 4 ] = i * 4 + 3;
+    mIndices[ i * 6 + 5 ] = i * 4;
+  }
+#endif
+}
+
+GameOverView::~GameOverView()
+{
+  mGridSquares = NULL;
+}
+
+void GameOverView::enter( FrameSnapshot& s )
+{
+  SDL_Color yourScoreColor = { 233, 82, 82 };
+  std::string yourScore = std::to_string( s.stats.score );
+  gYourScoreTextTexture.loadFromRenderedText( yourScore.c_str(), yourScoreColor );
+
+  SDL_Point yourScoreCenter;
+  yourScoreCenter.x = mYourScoreArea.x + ( mYourScoreArea.w / 2 );
+  yourScoreCenter.y = mYourScoreArea.y + ( mYourScoreArea.h / 2 );
+  mYourScorePosition.x = yourScoreCenter.x - ( gYourScoreTextTexture.getWidth() / 2 );
+  mYourScorePosition.y = yourScoreCenter.y - ( gYourScoreTextTexture.getHeight() / 2 );
+
+  captureBoard( s );
+
+  mTimeline.reset();
+}
+
+// Create the board's render target during play, the board itself is only known once the game ends
+void GameOverView::prepare( FrameSnapshot& s )
+{
+  createBoard();
+}
+
+void GameOverView::render( FrameSnapshot& s, float interpolation )
+{
+  int currentTicks = getRenderTicks( s, interpolation );
+  int lastBG = s.stats.currentBG;
+
+  mTimeline.evaluate( currentTicks );
+
+  if( mTimeline.hasChanged( mBoardAlphaTrack ) )
+  {
+    gBGTextures[ lastBG ].setAlpha( mTimeline.getValue( mBoardAlphaTrack ) );
+    gPlayBGTexture.setAlpha( mTimeline.getValue( mBoardAlphaTrack ) );
+  }
+
+  if( mTimeline.hasChanged( mPromptAlphaTrack ) )
+  {
+    gGameOverTexture.setAlpha( mTimeline.getValue( mPromptAlphaTrack ) );
+    gYourScoreTextTexture.setAlpha( mTimeline.getValue( mPromptAlphaTrack ) );
+  }
+
+  if( currentTicks < 4000 )
+  {
+    gRenderQueue.setLayer( RENDER_LAYER_BACKGROUND );
+    gBGTextures[ lastBG ].render( 0, 0 );
+    gRenderQueue.setLayer( RENDER_LAYER_FRAME );
+    gPlayBGTexture.render( 0, 0 );
+
+    renderBoard( currentTicks );
+  }
+
+  gRenderQueue.setLayer( RENDER_LAYER_PROMPT );
+  gBlankBGTexture.render( 0, 0 );
+
+  gRenderQueue.setLayer( RENDER_LAYER_PANEL );
+  gGameOverTexture.render( 0, 0 );
+  gRenderQueue.setLayer( RENDER_LAYER_LABEL );
+  gYourScoreTextTexture.render( mYourScorePosition.x, mYourScorePosition.y );
+}
+
+// Draw the visible grid into one texture and keep the clear time of every Square
+void GameOverView::captureBoard( FrameSnapshot& s )
+{
+  for( int i = 0; i < TOTAL_SQUARES; i++ )
+  {
+    mClearTimes[ i ] = s.clearTimes[ i ];
+  }
+
+  if( !createBoard() )
+  {
+    return;
+  }
+
+  mBoard.setAsRenderTarget();
+  SDL_SetRenderDrawColor( gRenderer, 0x00, 0x00, 0x00, 0x00 );
+  SDL_RenderClear( gRenderer );
+
+  gRenderQueue.setLayer( RENDER_LAYER_SQUARES );
+  for( int i = ( 2 * TOTAL_COLS ); i < TOTAL_SQUARES; i++ )
+  {
+    if( s.squareStates[ i ] != SQUARE_STATE_BLANK )
+    {
+      // Each Square lands on whole texels of the scaled board
+      SDL_Rect cell = { ( i % TOTAL_COLS ) * Square::SQUARE_WIDTH, ( i / TOTAL_COLS - 2 ) * Square::SQUARE_HEIGHT, Square::SQUARE_WIDTH, Square::SQUARE_HEIGHT };
+      SDL_Rect quad = mBoard.scaleRect( cell );
+      gSquareSpriteTexture.setAlpha( s.squareAlphas[ i ] );
+      gSquareSpriteTexture.renderScaled( quad, &gSquareSpriteClips[ s.squareSprites[ i ] ] );
+    }
+  }
+
+  // Draw into the board before the frame itself is recorded
+  gRenderQueue.submit();
+
+  SDL_SetRenderTarget( gRenderer, NULL );
+  SDL_SetRenderDrawColor( gRenderer, 0xFF, 0xFF, 0xFF, 0xFF );
+}
+
+// Draw every Square of the captured board not yet cleared at the given time
+void GameOverView::renderBoard( int ticks )
+{
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+  int count = 0;
+  SDL_Color color = { 255, 255, 255, 255 };
+
+  for( int i = ( 2 * TOTAL_COLS ); i < TOTAL_SQUARES; i++ )
+  {
+    if( ticks >= mClearTimes[ i ] )
+    {
+      continue;
+    }
+
+    float u = ( i % TOTAL_COLS ) * Square::SQUARE_WIDTH;
+    float v = ( i / TOTAL_COLS - 2 ) * Square::SQUARE_HEIGHT;
+
+    SDL_Vertex* corners = &mVertices[ count * 4 ];
+    for( int c = 0; c < 4; c++ )
+    {
+      float dx = ( c == 1 || c == 2 ) ? Square::SQUARE_WIDTH : 0;
+      float dy = ( c >= 2 ) ? Square::SQUARE_HEIGHT : 0;
+      corners[ c ].position.x = mBoardPosition.x + u + dx;
+      corners[ c ].position.y = mBoardPosition.y + v + dy;
+      corners[ c ].tex_coord.x = u + dx;
+      corners[ c ].tex_coord.y = v + dy;
+      corners[ c ].color = color;
+    }
+    count++;
+  }
+
+  if( count > 0 )
+  {
+    mBoard.renderGeometry( mVertices, count * 4, mIndices, count * 6 );
+  }
+#else
+  // Without geometry support each Square is its own copy of the board texture
+  gRenderQueue.setLayer( RENDER_LAYER_SQUARES );
+  mBoard.setAlpha( 255 );
+  for( int i = ( 2 * TOTAL_COLS ); i < TOTAL_SQUARES; i++ )
+  {
+    if( ticks < mClearTimes[ i ] )
+    {
+      SDL_Rect clip = { ( i % TOTAL_COLS ) * Square::SQUARE_WIDTH, ( i / TOTAL_COLS - 2 ) * Square::SQUARE_HEIGHT, Square::SQUARE_WIDTH, Square::SQUARE_HEIGHT };
+      mBoard.render( mBoardPosition.x + clip.x, mBoardPosition.y + clip.y, &clip );
+    }
+  }
+#endif
+}
+
+// Texture the visible grid is drawn into, created the first time it is needed and again after the output scale changes
+bool GameOverView::createBoard()
+{
+  int width = TOTAL_COLS * Square::SQUARE_WIDTH;
+  int height = ( TOTAL_ROWS - 2 ) * Square::SQUARE_HEIGHT;
+  float scale = LTexture::getScale();
+
+  if( mBoard.getWidth() == width && mBoardScale == scale )
+  {
+    return true;
+  }
+
+  mBoardScale = 0.0f;
+  if( !mBoard.createBlank( width, height, SDL_TEXTUREACCESS_TARGET, scale ) )
+  {
+    return false;
+  }
+  mBoard.setBlendMode( SDL_BLENDMODE_BLEND );
+  mBoardScale = scale;
+
+  return true;
+}
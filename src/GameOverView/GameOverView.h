@@ -0,0 +1,49 @@
+#ifndef GAMEOVERVIEW_H
+#define GAMEOVERVIEW_H
+
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../LTexture/LTexture.h"
+#include "../Square/Square.h"
+#include "../Timeline/Timeline.h"
+#include "../View/View.h"
+
+class GameOverView : public View
+{
+  public:
+  GameOverView( Square* gridSquares, SDL_Rect& yourScoreArea );
+  ~GameOverView();
+
+  void enter( FrameSnapshot& s );
+  void prepare( FrameSnapshot& s );
+  void render( FrameSnapshot& s, float interpolation );
+
+  private:
+  bool createBoard();
+  void captureBoard( FrameSnapshot& s );
+  void renderBoard( int ticks );
+
+  Square* mGridSquares;
+  SDL_Rect mYourScoreArea;
+  SDL_Point mYourScorePosition;
+
+  Timeline mTimeline;
+  int mBoardAlphaTrack;
+  int mPromptAlphaTrack;
+
+  // Final board drawn once, then dissolved by each Square's clear time
+  LTexture mBoard;
+  float mBoardScale;
+  SDL_Point mBoardPosition;
+  Uint16 mClearTimes[ TOTAL_SQUARES ];
+
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+  // Four corners and two triangles per visible Square
+  SDL_Vertex mVertices[ TOTAL_SQUARES * 4 ];
+  int mIndices[ TOTAL_SQUARES * 6 ];
+#endif
+};
+
+#endif
@@ -1,7 +1,22 @@
+#include <SDL2/SDL.h>
+
 #include "../constants.h"
+#include "../globals/globals.h"
+#include "../Square/Square.h"
 #include "GameState.h"
 
 GameStateFlag GameState::getNextState()
 {
   return mNextState;
 }
+
+// Copy the contents of every grid Square into a snapshot
+void GameState::snapshotGrid( FrameSnapshot& s, Square* gridSquares )
+{
+  for( int i = 0; i < TOTAL_SQUARES; i++ )
+  {
+    s.squareStates[ i ] = gridSquares[ i ].getState();
+    s.squareSprites[ i ] = gridSquares[ i ].getSprite();
+    s.squareAlphas[ i ] = gridSquares[ i ].getAlpha();
+  }
+}
@@ -4,19 +4,29 @@
 #include <SDL2/SDL.h>
 
 #include "../constants.h"
+#include "../globals/globals.h"
 #include "../Timer/Timer.h"
+#include "../Square/Square.h"
 
+// One screen of game logic. States live as long as the simulation and are
+// entered again each time the game returns to them.
 class GameState
 {
   public:
+  virtual ~GameState() {}
+
+  virtual void enter() = 0;
+  virtual void exit() {}
   virtual void handleEvent( SDL_Event& e ) = 0;
   virtual void logic() = 0;
-  virtual void render() = 0;
+  virtual void snapshot( FrameSnapshot& s ) = 0;
   GameStateFlag getNextState();
 
   protected:
+  void snapshotGrid( FrameSnapshot& s, Square* gridSquares );
+
   Timer mTimer;
   GameStateFlag mNextState;
 };
 
-#endif 
+#endif
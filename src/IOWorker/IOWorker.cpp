@@ -0,0 +1,436 @@
+#include <SDL2/SDL.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <set>
+#include <string>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "IOWorker.h"
+
+IOWorker gIOWorker;
+
+// Initialize member variables
+IOWorker::IOWorker()
+{
+  mFirst = 0;
+  mCount = 0;
+  mWriting = 0;
+  mQuit = false;
+  mThread = NULL;
+  mMutex = NULL;
+  mJobAdded = NULL;
+  mSpaceFree = NULL;
+  mPeakDepth = 0;
+  mWritten = 0;
+  mStalls = 0;
+  mFailures = 0;
+  mLatency = 0.0f;
+  mPeakLatency = 0.0f;
+}
+
+// Finish any writes still queued
+IOWorker::~IOWorker()
+{
+  stop();
+}
+
+// Begin writing in the background. Until then, or if no thread can be
+// made, every write happens right away on the thread asking for it.
+bool IOWorker::start()
+{
+  mMutex = SDL_CreateMutex();
+  mJobAdded = SDL_CreateCond();
+  mSpaceFree = SDL_CreateCond();
+  if( mMutex == NULL || mJobAdded == NULL || mSpaceFree == NULL )
+  {
+    printf( "Could not create I/O worker lock! SDL Error: %s\n", SDL_GetError() );
+    stop();
+    return false;
+  }
+
+  // Without the thread the lock still keeps writes from two threads apart
+  mQuit = false;
+  mThread = SDL_CreateThread( run, "IOWorker", this );
+  if( mThread == NULL )
+  {
+    printf( "Could not create I/O worker thread! SDL Error: %s\n", SDL_GetError() );
+    return false;
+  }
+
+  return true;
+}
+
+// Wait until every queued write is on disk, then end the thread
+void IOWorker::stop()
+{
+  if( mThread != NULL )
+  {
+    SDL_LockMutex( mMutex );
+    mQuit = true;
+    SDL_CondSignal( mJobAdded );
+    SDL_UnlockMutex( mMutex );
+
+    SDL_WaitThread( mThread, NULL );
+    mThread = NULL;
+
+    printf( "Finished %d background writes, queue peaked at %d, slowest write %.1f ms, %d full queue waits\n", mWritten, mPeakDepth, mPeakLatency, mStalls );
+  }
+
+  if( mSpaceFree != NULL )
+  {
+    SDL_DestroyCond( mSpaceFree );
+    mSpaceFree = NULL;
+  }
+  if( mJobAdded != NULL )
+  {
+    SDL_DestroyCond( mJobAdded );
+    mJobAdded = NULL;
+  }
+  if( mMutex != NULL )
+  {
+    SDL_DestroyMutex( mMutex );
+    mMutex = NULL;
+  }
+}
+
+// Add bytes to the end of a file
+bool IOWorker::append( std::string path, const void* data, size_t size )
+{
+  return push( IO_JOB_APPEND, "", path, NULL, 0, data, size );
+}
+
+// Swap a file for a header followed by data, so readers see the old file or the new one
+bool IOWorker::replace( std::string path, const void* header, size_t headerSize, const void* data, size_t size )
+{
+  return push( IO_JOB_REPLACE, "", path, header, headerSize, data, size );
+}
+
+// Replace a file only if the last write to another file, queued before this, succeeded
+bool IOWorker::replaceAfter( std::string after, std::string path, const void* header, size_t headerSize, const void* data, size_t size )
+{
+  return push( IO_JOB_REPLACE, after, path, header, headerSize, data, size );
+}
+
+// Writes queued or being written
+int IOWorker::getQueueDepth()
+{
+  if( mThread == NULL )
+  {
+    return 0;
+  }
+
+  SDL_LockMutex( mMutex );
+  int depth = mCount + mWriting;
+  SDL_UnlockMutex( mMutex );
+
+  return depth;
+}
+
+int IOWorker::getPeakQueueDepth()
+{
+  return mPeakDepth;
+}
+
+// Milliseconds from queueing to being on disk for the slowest job of the last batch
+float IOWorker::getLatency()
+{
+  if( mThread == NULL )
+  {
+    return mLatency;
+  }
+
+  SDL_LockMutex( mMutex );
+  float latency = mLatency;
+  SDL_UnlockMutex( mMutex );
+
+  return latency;
+}
+
+float IOWorker::getPeakLatency()
+{
+  return mPeakLatency;
+}
+
+// Times a producer had to wait for room in the queue
+int IOWorker::getStalls()
+{
+  return mStalls;
+}
+
+int IOWorker::getFailures()
+{
+  return mFailures;
+}
+
+// Worker entry point writing batches until stopped with nothing left
+int IOWorker::run( void* data )
+{
+  IOWorker* worker = (IOWorker*)data;
+
+  SDL_LockMutex( worker->mMutex );
+  while( true )
+  {
+    while( worker->mCount == 0 && !worker->mQuit )
+    {
+      SDL_CondWait( worker->mJobAdded, worker->mMutex );
+    }
+
+    if( worker->mCount == 0 )
+    {
+      break;
+    }
+
+    worker->drain();
+  }
+  SDL_UnlockMutex( worker->mMutex );
+
+  return 0;
+}
+
+// Copy the bytes into a new job and queue it
+bool IOWorker::push( IOJobType type, std::string after, std::string path, const void* header, size_t headerSize, const void* data, size_t size )
+{
+  if( path.size() >= (size_t)IO_PATH_LENGTH || after.size() >= (size_t)IO_PATH_LENGTH )
+  {
+    printf( "Warning: Path %s is too long to write!\n", path.c_str() );
+    return false;
+  }
+
+  IOJob job;
+  job.type = type;
+  strcpy( job.path, path.c_str() );
+  strcpy( job.after, after.c_str() );
+  job.size = headerSize + size;
+  job.data = (Uint8*)malloc( job.size > 0 ? job.size : 1 );
+  if( job.data == NULL )
+  {
+    printf( "Warning: Out of memory writing %s!\n", path.c_str() );
+    return false;
+  }
+  if( headerSize > 0 )
+  {
+    memcpy( job.data, header, headerSize );
+  }
+  if( size > 0 )
+  {
+    memcpy( job.data + headerSize, data, size );
+  }
+  job.queued = SDL_GetPerformanceCounter();
+
+  // Without a worker, write it right here
+  if( mThread == NULL )
+  {
+    if( mMutex != NULL )
+    {
+      SDL_LockMutex( mMutex );
+    }
+
+    int failures = commit( &job, 1 );
+    record( &job, 1, failures );
+
+    if( mMutex != NULL )
+    {
+      SDL_UnlockMutex( mMutex );
+    }
+
+    return failures == 0;
+  }
+
+  SDL_LockMutex( mMutex );
+
+  if( mCount == IO_QUEUE_SIZE )
+  {
+    mStalls++;
+    while( mCount == IO_QUEUE_SIZE )
+    {
+      SDL_CondWait( mSpaceFree, mMutex );
+    }
+  }
+
+  mJobs[ ( mFirst + mCount ) % IO_QUEUE_SIZE ] = job;
+  mCount++;
+  if( mCount + mWriting > mPeakDepth )
+  {
+    mPeakDepth = mCount + mWriting;
+  }
+
+  SDL_CondSignal( mJobAdded );
+  SDL_UnlockMutex( mMutex );
+
+  return true;
+}
+
+// Take every queued job and write it with the lock released. Called with the lock held.
+void IOWorker::drain()
+{
+  IOJob batch[ IO_QUEUE_SIZE ];
+  int count = mCount;
+  for( int i = 0; i < count; i++ )
+  {
+    batch[ i ] = mJobs[ ( mFirst + i ) % IO_QUEUE_SIZE ];
+  }
+
+  mFirst = ( mFirst + count ) % IO_QUEUE_SIZE;
+  mCount = 0;
+  mWriting = count;
+  SDL_CondBroadcast( mSpaceFree );
+
+  SDL_UnlockMutex( mMutex );
+  int failures = commit( batch, count );
+  SDL_LockMutex( mMutex );
+
+  mWriting = 0;
+  record( batch, count, failures );
+}
+
+// Note how long a finished batch took and free its bytes
+void IOWorker::record( IOJob* jobs, int count, int failures )
+{
+  Uint64 now = SDL_GetPerformanceCounter();
+  float latency = 0.0f;
+
+  for( int i = 0; i < count; i++ )
+  {
+    float jobLatency = ( now - jobs[ i ].queued ) * 1000.0f / SDL_GetPerformanceFrequency();
+    if( jobLatency > latency )
+    {
+      latency = jobLatency;
+    }
+
+    free( jobs[ i ].data );
+    jobs[ i ].data = NULL;
+  }
+
+  mLatency = latency;
+  if( latency > mPeakLatency )
+  {
+    mPeakLatency = latency;
+  }
+
+  mWritten += count;
+  mFailures += failures;
+}
+
+// Write a batch in the order it was queued, returning how many jobs failed
+int IOWorker::commit( IOJob* jobs, int count )
+{
+  int failures = 0;
+
+  for( int i = 0; i < count; i++ )
+  {
+    if( jobs[ i ].type == IO_JOB_REPLACE )
+    {
+      // The same file is replaced again right after, so only the newer copy is written
+      if( i + 1 < count && jobs[ i + 1 ].type == IO_JOB_REPLACE && strcmp( jobs[ i + 1 ].path, jobs[ i ].path ) == 0 &&
+	  strcmp( jobs[ i + 1 ].after, jobs[ i ].after ) == 0 )
+      {
+	continue;
+      }
+
+      // The file this one depends on was not written, so leave this one as it was
+      if( jobs[ i ].after[ 0 ] != '\0' && mFailedPaths.count( jobs[ i ].after ) > 0 )
+      {
+	printf( "Warning: Not writing %s because %s could not be written!\n", jobs[ i ].path, jobs[ i ].after );
+	mFailedPaths.insert( jobs[ i ].path );
+	failures++;
+	continue;
+      }
+
+      if( replaceFile( jobs[ i ] ) )
+      {
+	mFailedPaths.erase( jobs[ i ].path );
+      }
+      else
+      {
+	printf( "Warning: Unable to write %s!\n", jobs[ i ].path );
+	mFailedPaths.insert( jobs[ i ].path );
+	failures++;
+      }
+    }
+    else
+    {
+      // Appends in a row to one file share a single sync
+      int last = i;
+      while( last + 1 < count && jobs[ last + 1 ].type == IO_JOB_APPEND && strcmp( jobs[ last + 1 ].path, jobs[ i ].path ) == 0 )
+      {
+	last++;
+      }
+
+      if( appendFile( &jobs[ i ], last - i + 1 ) )
+      {
+	mFailedPaths.erase( jobs[ i ].path );
+      }
+      else
+      {
+	printf( "Warning: Unable to append to %s!\n", jobs[ i ].path );
+	mFailedPaths.insert( jobs[ i ].path );
+	failures += last - i + 1;
+      }
+
+      i = last;
+    }
+  }
+
+  return failures;
+}
+
+// Add several jobs' bytes to the end of their file and sync once
+bool IOWorker::appendFile( IOJob* jobs, int count )
+{
+  FILE* file = fopen( jobs[ 0 ].path, "ab" );
+  if( file == NULL )
+  {
+    return false;
+  }
+
+  bool success = true;
+  for( int i = 0; i < count && success; i++ )
+  {
+    success = jobs[ i ].size == 0 || fwrite( jobs[ i ].data, jobs[ i ].size, 1, file ) == 1;
+  }
+  success = success && fflush( file ) == 0 && fsync( fileno( file ) ) == 0;
+
+  return fclose( file ) == 0 && success;
+}
+
+// Replace a file in one step: write and sync a copy beside it, then rename it over
+bool IOWorker::replaceFile( IOJob& job )
+{
+  std::string path = job.path;
+  std::string partial = path + ".part";
+  FILE* file = fopen( partial.c_str(), "wb" );
+  if( file == NULL )
+  {
+    return false;
+  }
+
+  bool success = job.size == 0 || fwrite( job.data, job.size, 1, file ) == 1;
+  success = success && fflush( file ) == 0 && fsync( fileno( file ) ) == 0;
+
+  if( fclose( file ) != 0 || !success || rename( partial.c_str(), path.c_str() ) != 0 )
+  {
+    remove( partial.c_str() );
+    return false;
+  }
+
+  syncDirectory( path );
+  return true;
+}
+
+// Make a rename inside a directory survive a power cut
+void IOWorker::syncDirectory( std::string path )
+{
+  size_t slash = path.find_last_of( '/' );
+  std::string directory = slash == std::string::npos ? "." : path.substr( 0, slash );
+
+  int fd = ::open( directory.c_str(), O_RDONLY );
+  if( fd != -1 )
+  {
+    fsync( fd );
+    ::close( fd );
+  }
+}
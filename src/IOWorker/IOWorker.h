@@ -0,0 +1,72 @@
+#ifndef IOWORKER_H
+#define IOWORKER_H
+
+#include <SDL2/SDL.h>
+#include <set>
+#include <string>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+
+// Writes files on a background thread so neither the simulation nor the
+// renderer waits on the disk. Each job carries its own copy of the bytes.
+// The worker takes every queued job at once, appends to one file with a
+// single sync, and skips a replacement that is replaced again right after.
+// A replacement can be made to depend on another file, so it is skipped
+// unless the last write to that file succeeded.
+// A producer only waits when the queue is full; stop() waits until every
+// job is on disk.
+class IOWorker
+{
+  public:
+  IOWorker();
+  ~IOWorker();
+
+  bool start();
+  void stop();
+
+  bool append( std::string path, const void* data, size_t size );
+  bool replace( std::string path, const void* header, size_t headerSize, const void* data, size_t size );
+  bool replaceAfter( std::string after, std::string path, const void* header, size_t headerSize, const void* data, size_t size );
+
+  int getQueueDepth();
+  int getPeakQueueDepth();
+  float getLatency();
+  float getPeakLatency();
+  int getStalls();
+  int getFailures();
+
+  private:
+  static int run( void* data );
+  bool push( IOJobType type, std::string after, std::string path, const void* header, size_t headerSize, const void* data, size_t size );
+  void drain();
+  void record( IOJob* jobs, int count, int failures );
+
+  int commit( IOJob* jobs, int count );
+  static bool appendFile( IOJob* jobs, int count );
+  static bool replaceFile( IOJob& job );
+  static void syncDirectory( std::string path );
+
+  IOJob mJobs[ IO_QUEUE_SIZE ];
+  std::set<std::string> mFailedPaths;
+  int mFirst;
+  int mCount;
+  int mWriting;
+  bool mQuit;
+
+  SDL_Thread* mThread;
+  SDL_mutex* mMutex;
+  SDL_cond* mJobAdded;
+  SDL_cond* mSpaceFree;
+
+  int mPeakDepth;
+  int mWritten;
+  int mStalls;
+  int mFailures;
+  float mLatency;
+  float mPeakLatency;
+};
+
+extern IOWorker gIOWorker;
+
+#endif
@@ -0,0 +1,51 @@
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+#include "InputQueue.h"
+
+// Start empty
+InputQueue::InputQueue()
+{
+  SDL_AtomicSet( &mHead, 0 );
+  SDL_AtomicSet( &mTail, 0 );
+  mDropped = 0;
+}
+
+// Add an event, dropping it if the queue is full
+bool InputQueue::push( SDL_Event& e )
+{
+  int tail = SDL_AtomicGet( &mTail );
+  int next = ( tail + 1 ) % INPUT_QUEUE_SIZE;
+
+  if( next == SDL_AtomicGet( &mHead ) )
+  {
+    mDropped++;
+    return false;
+  }
+
+  mEvents[ tail ] = e;
+  SDL_AtomicSet( &mTail, next );
+
+  return true;
+}
+
+// Remove the oldest event if there is one
+bool InputQueue::pop( SDL_Event& e )
+{
+  int head = SDL_AtomicGet( &mHead );
+
+  if( head == SDL_AtomicGet( &mTail ) )
+  {
+    return false;
+  }
+
+  e = mEvents[ head ];
+  SDL_AtomicSet( &mHead, ( head + 1 ) % INPUT_QUEUE_SIZE );
+
+  return true;
+}
+
+int InputQueue::getDropped()
+{
+  return mDropped;
+}
@@ -0,0 +1,29 @@
+#ifndef INPUTQUEUE_H
+#define INPUTQUEUE_H
+
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+
+// Lock-free queue of input events from one producer to one consumer
+class InputQueue
+{
+  public:
+  InputQueue();
+
+  bool push( SDL_Event& e );
+  bool pop( SDL_Event& e );
+
+  // Events the producer had to throw away
+  int getDropped();
+
+  private:
+  SDL_Event mEvents[ INPUT_QUEUE_SIZE ];
+  SDL_atomic_t mHead;
+  SDL_atomic_t mTail;
+
+  // Only the producer touches this
+  int mDropped;
+};
+
+#endif
@@ -0,0 +1,111 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <string>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../LTexture/LTexture.h"
+#include "../textures/textures.h"
+#include "../Timeline/Timeline.h"
+#include "../View/View.h"
+#include "IntroView.h"
+
+// Hand fading and opening in, then closing and fading out before the high scores
+static const Keyframe HAND_ALPHA_KEYS[] = { { 0, 0 }, { 250, 255 }, { 9750, 255 }, { 10000, 0 } };
+static const Keyframe HAND_FRAME_KEYS[] = { { 0, 0 }, { 50, 1 }, { 100, 2 }, { 150, 3 }, { 200, 4 },
+					    { 9750, 4 }, { 9800, 3 }, { 9850, 2 }, { 9900, 1 }, { 9950, 0 } };
+static const Keyframe PIECE_ALPHA_KEYS[] = { { 0, 0 }, { 2000, 255 }, { 8000, 255 }, { 10000, 0 } };
+
+IntroView::IntroView( SDL_Rect* startAreas, SDL_Rect& listArea )
+{
+  mStartAreas[ 0 ] = startAreas[ 0 ];
+  mStartAreas[ 1 ] = startAreas[ 1 ];
+  mListArea = listArea;
+
+  mHandAlphaTrack = mTimeline.addTrack( HAND_ALPHA_KEYS, 4 );
+  mHandFrameTrack = mTimeline.addTrack( HAND_FRAME_KEYS, 10, true );
+  mPieceAlphaTrack = mTimeline.addTrack( PIECE_ALPHA_KEYS, 4 );
+  mPromptTrack = addPulseTrack( mTimeline );
+  addListTracks( mTimeline, 10000, mListTracks );
+}
+
+void IntroView::enter( FrameSnapshot& s )
+{
+  // Usually still showing the list the score list screen ended on
+  loadListText( s.scores );
+
+  for( int i = 0; i < TOTAL_SCORES; i++ )
+  {
+    gListTextTextures[ i ].setAlpha( 0 );
+    gListTextTextures[ i + TOTAL_SCORES ].setAlpha( 0 );
+    mListCenters[ i ].x = mListArea.x + ( mListArea.w / 2 );
+    mListCenters[ i ].y = mListArea.y + ( i * gListClips[ 0 ].h ) + ( gListClips[ 0 ].h / 2 );
+    mListPositions[ i ].x = mListCenters[ i ].x - ( gListTextTextures[ i ].getWidth() / 2 );
+    mListPositions[ i ].y = mListCenters[ i ].y - ( gListTextTextures[ i ].getHeight() / 2 );
+  }
+
+  mTimeline.reset();
+}
+
+void IntroView::render( FrameSnapshot& s, float interpolation )
+{
+  gRenderQueue.setLayer( RENDER_LAYER_BACKGROUND );
+  gBlankBGTexture.render( 0, 0 );
+
+  int currentTicks = getRenderTicks( s, interpolation );
+  // Interpolation must not run past the end of the intro loop
+  if( currentTicks > 19999 )
+  {
+    currentTicks = 19999;
+  }
+
+  mTimeline.evaluate( currentTicks );
+
+  // Only textures drawn once per frame keep their alpha between frames
+  if( mTimeline.hasChanged( mHandAlphaTrack ) )
+  {
+    gHandBlackTexture.setAlpha( mTimeline.getValue( mHandAlphaTrack ) );
+  }
+
+  if( mTimeline.hasChanged( mPromptTrack ) )
+  {
+    gPressEnterTexture.setAlpha( mTimeline.getValue( mPromptTrack ) );
+  }
+
+  for( int i = 0; i < TOTAL_SCORES; i++ )
+  {
+    if( mTimeline.hasChanged( mListTracks[ i ] ) )
+    {
+      gListTextTextures[ i ].setAlpha( mTimeline.getValue( mListTracks[ i ] ) );
+      gListTextTextures[ i + TOTAL_SCORES ].setAlpha( mTimeline.getValue( mListTracks[ i ] ) );
+    }
+  }
+
+  if( currentTicks < 10000 )
+  {
+    gRenderQueue.setLayer( RENDER_LAYER_DECORATION );
+    gHandBlackTexture.render( 0, ( SCREEN_HEIGHT / 2 ) - 138, &gHandClips[ mTimeline.getValue( mHandFrameTrack ) ] );
+
+    gRenderQueue.setLayer( RENDER_LAYER_SQUARES );
+    TetrominoFlag type = (TetrominoFlag)( ( currentTicks / 100 ) % TETROMINO_COUNT );
+    gPreviewCache.render( type, mStartAreas[ 0 ], mTimeline.getValue( mPieceAlphaTrack ) );
+    gPreviewCache.render( type, mStartAreas[ 1 ], mTimeline.getValue( mPieceAlphaTrack ) );
+
+    gRenderQueue.setLayer( RENDER_LAYER_PROMPT );
+    gPressEnterTexture.render( 0, 0 );
+  }
+  else
+  {
+    int x = 275, y = 25;
+
+    for( int i = 0; i < TOTAL_SCORES; i++ )
+    {
+      gListTexture.setAlpha( mTimeline.getValue( mListTracks[ i ] ) );
+      gRenderQueue.setLayer( RENDER_LAYER_PANEL );
+      gListTexture.render( x, y + ( i * 100 ), &gListClips[ i ] );
+      gRenderQueue.setLayer( RENDER_LAYER_LABEL );
+      gListTextTextures[ i ].render( mListPositions[ i ].x, mListPositions[ i ].y );
+      gListTextTextures[ i + TOTAL_SCORES ].render( mListCenters[ i ].x + 13, mListCenters[ i ].y + 13 );
+    }
+  }
+}
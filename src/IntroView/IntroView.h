@@ -0,0 +1,33 @@
+#ifndef INTROVIEW_H
+#define INTROVIEW_H
+
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../Timeline/Timeline.h"
+#include "../View/View.h"
+
+class IntroView : public View
+{
+  public:
+  IntroView( SDL_Rect* startAreas, SDL_Rect& listArea );
+
+  void enter( FrameSnapshot& s );
+  void render( FrameSnapshot& s, float interpolation );
+
+  private:
+  SDL_Rect mStartAreas[ 2 ];
+  SDL_Rect mListArea;
+  SDL_Point mListCenters[ TOTAL_SCORES ];
+  SDL_Point mListPositions[ TOTAL_SCORES ];
+
+  Timeline mTimeline;
+  int mHandAlphaTrack;
+  int mHandFrameTrack;
+  int mPieceAlphaTrack;
+  int mPromptTrack;
+  int mListTracks[ TOTAL_SCORES ];
+};
+
+#endif
@@ -1,18 +1,32 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 #include <SDL2/SDL_ttf.h>
+#include <math.h>
 #include <stdio.h>
 #include <string>
 
 #include "../globals/globals.h"
+#include "../AssetPack/AssetPack.h"
+#include "../TextureCache/TextureCache.h"
+#include "../RenderQueue/RenderQueue.h"
+#include "../textures/textures.h"
 #include "LTexture.h"
 
+// Output pixels per screen pixel that images and text are rasterized at
+float LTexture::sScale = 1.0f;
+
+// Handed out whenever a texture's contents change, so redraws can be skipped safely
+Uint32 LTexture::sNextVersion = 1;
+
 // Initialize member variables
 LTexture::LTexture()
 {
   mTexture = NULL;
   mWidth = 0;
   mHeight = 0;
+  mAlpha = 255;
+  mScale = 1.0f;
+  mVersion = 0;
 }
 
 // Free texture
@@ -23,12 +37,67 @@ LTexture::~LTexture()
 
 // Load image from file destination
 bool LTexture::loadFromFile( std::string path )
+{
+  DecodedImage image;
+  decode( path, getMaxTextureSize(), getTextureFormat(), image );
+
+  return loadFromDecoded( image, path );
+}
+
+// Upload an image decoded ahead of time, freeing its surface
+bool LTexture::loadFromDecoded( DecodedImage& image, std::string path )
 {
   free();
 
-  SDL_Texture* newTexture = NULL;
+  if( image.surface != NULL )
+  {
+    mTexture = SDL_CreateTextureFromSurface( gRenderer, image.surface );
+    if( mTexture == NULL )
+    {
+      printf( "Failed to create texture from %s! SDL Error: %s\n", path.c_str(), SDL_GetError() );
+    }
+    else
+    {
+      mWidth = image.width;
+      mHeight = image.height;
+      mScale = image.scale;
+    }
 
-  SDL_Surface* loadedSurface = IMG_Load( path.c_str() );
+    SDL_FreeSurface( image.surface );
+    image.surface = NULL;
+  }
+
+  mVersion = sNextVersion++;
+  return mTexture != NULL;
+}
+
+// Read an image, rasterized at the output scale in the renderer's pixel format,
+// without touching the renderer. Cached images skip the PNG entirely.
+bool LTexture::decode( std::string path, SDL_Point maxSize, Uint32 format, DecodedImage& image )
+{
+  Uint64 start = SDL_GetPerformanceCounter();
+
+  image.decodeStart = start;
+  image.surface = NULL;
+  image.width = 0;
+  image.height = 0;
+  image.scale = 1.0f;
+
+  SDL_RWops* file = gAssetPack.openFile( path );
+
+  std::string cachePath;
+  if( file != NULL && gTextureCache.isEnabled() )
+  {
+    cachePath = gTextureCache.getPath( file, sScale, format );
+    if( gTextureCache.read( cachePath, image ) )
+    {
+      SDL_RWclose( file );
+      image.decodeTime = SDL_GetPerformanceCounter() - start;
+      return true;
+    }
+  }
+
+  SDL_Surface* loadedSurface = IMG_Load_RW( file, 1 );
   if( loadedSurface == NULL )
   {
     printf( "Failed to load image %s! SDL_image Error: %s\n", path.c_str(), IMG_GetError() );
@@ -36,23 +105,35 @@ bool LTexture::loadFromFile( std::string path )
   else
   {
     SDL_SetColorKey( loadedSurface, SDL_TRUE, SDL_MapRGB( loadedSurface->format, 0xFF, 0xFF, 0xFF ) );
-    
-    newTexture = SDL_CreateTextureFromSurface( gRenderer, loadedSurface );
-    if( newTexture == NULL )
+
+    image.width = loadedSurface->w;
+    image.height = loadedSurface->h;
+    SDL_Surface* scaledSurface = rasterize( loadedSurface, maxSize, image.scale );
+
+    // Converting bakes the color key into alpha, leaving the upload a plain copy
+    image.surface = SDL_ConvertSurfaceFormat( scaledSurface, format, 0 );
+    if( image.surface == NULL )
     {
-      printf( "Failed to create texture from %s! SDL Error: %s\n", path.c_str(), SDL_GetError() );
+      image.surface = scaledSurface;
     }
-    else
+    else if( scaledSurface != loadedSurface )
     {
-      mWidth = loadedSurface->w;
-      mHeight = loadedSurface->h;
+      SDL_FreeSurface( scaledSurface );
     }
 
-    SDL_FreeSurface( loadedSurface );
+    if( image.surface != loadedSurface )
+    {
+      SDL_FreeSurface( loadedSurface );
+
+      if( !cachePath.empty() )
+      {
+	gTextureCache.write( cachePath, image );
+      }
+    }
   }
 
-  mTexture = newTexture;
-  return mTexture != NULL;
+  image.decodeTime = SDL_GetPerformanceCounter() - start;
+  return image.surface != NULL;
 }
 
 // Load text image from font
@@ -74,13 +155,37 @@ bool LTexture::loadFromRenderedText( std::string textureText, SDL_Color textColo
     }
     else
     {
-      mWidth = textSurface->w;
-      mHeight = textSurface->h;
+      // The font is opened at the output scale, so measure in screen pixels
+      mScale = sScale;
+      mWidth = lroundf( textSurface->w / mScale );
+      mHeight = lroundf( textSurface->h / mScale );
     }
 
     SDL_FreeSurface( textSurface );
   }
 
+  mVersion = sNextVersion++;
+  return mTexture != NULL;
+}
+
+// Create a blank texture that can be rendered to or streamed into, sized in screen pixels and holding scale texels per pixel
+bool LTexture::createBlank( int width, int height, SDL_TextureAccess access, float scale )
+{
+  free();
+
+  mTexture = SDL_CreateTexture( gRenderer, SDL_PIXELFORMAT_RGBA8888, access, lroundf( width * scale ), lroundf( height * scale ) );
+  if( mTexture == NULL )
+  {
+    printf( "Unable to create blank texture! SDL Error: %s\n", SDL_GetError() );
+  }
+  else
+  {
+    mWidth = width;
+    mHeight = height;
+    mScale = scale;
+  }
+
+  mVersion = sNextVersion++;
   return mTexture != NULL;
 }
   
@@ -93,6 +198,8 @@ void LTexture::free()
     mTexture = NULL;
     mWidth = 0;
     mHeight = 0;
+    mAlpha = 255;
+    mScale = 1.0f;
   }
 }
 
@@ -102,13 +209,13 @@ void LTexture::setBlendMode( SDL_BlendMode blending )
   SDL_SetTextureBlendMode( mTexture, blending );
 }
 
-// Adjust alpha
+// Adjust alpha, applied to each render queued from now on
 void LTexture::setAlpha( Uint8 alpha )
 {
-  SDL_SetTextureAlphaMod( mTexture, alpha );
+  mAlpha = alpha;
 }
 
-// Render image at (x,y) location on screen
+// Queue image at (x,y) location on screen
 void LTexture::render( int x, int y, SDL_Rect* clip )
 {
   SDL_Rect renderQuad = { x, y, mWidth, mHeight };
@@ -120,7 +227,155 @@ void LTexture::render( int x, int y, SDL_Rect* clip )
     renderQuad.h = clip->h;
   }
 
-  SDL_RenderCopy( gRenderer, mTexture, clip, &renderQuad );
+  SDL_Rect source;
+  if( clip != NULL && mScale != 1.0f )
+  {
+    source = scaleRect( *clip );
+    clip = &source;
+  }
+
+  gRenderQueue.push( mTexture, clip, renderQuad, mAlpha, mVersion );
+}
+
+// Queue image stretched over a screen Rect
+void LTexture::renderScaled( SDL_Rect& quad, SDL_Rect* clip )
+{
+  SDL_Rect source;
+  if( clip != NULL && mScale != 1.0f )
+  {
+    source = scaleRect( *clip );
+    clip = &source;
+  }
+
+  gRenderQueue.push( mTexture, clip, quad, mAlpha, mVersion );
+}
+
+// Replace part of a streaming texture with RGBA8888 pixels
+void LTexture::updatePixels( SDL_Rect* rect, void* pixels, int pitch )
+{
+  SDL_UpdateTexture( mTexture, rect, pixels, pitch );
+  mVersion = sNextVersion++;
+}
+
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+// Queue triangles textured with this image, texture coordinates in pixels
+void LTexture::renderGeometry( SDL_Vertex* vertices, int numVertices, int* indices, int numIndices )
+{
+  for( int i = 0; i < numVertices; i++ )
+  {
+    vertices[ i ].tex_coord.x /= mWidth;
+    vertices[ i ].tex_coord.y /= mHeight;
+  }
+
+  gRenderQueue.pushGeometry( mTexture, vertices, numVertices, indices, numIndices );
+}
+#endif
+
+// Make this texture the target of following renders
+void LTexture::setAsRenderTarget()
+{
+  SDL_SetRenderTarget( gRenderer, mTexture );
+  mVersion = sNextVersion++;
+}
+
+// Set the scale images and text loaded from now on are rasterized at
+void LTexture::setScale( float scale )
+{
+  sScale = scale;
+}
+
+float LTexture::getScale()
+{
+  return sScale;
+}
+
+// Largest texture the renderer can hold, or no limit when it does not say
+SDL_Point LTexture::getMaxTextureSize()
+{
+  SDL_Point size = { 0, 0 };
+
+  SDL_RendererInfo info;
+  if( SDL_GetRendererInfo( gRenderer, &info ) == 0 )
+  {
+    size.x = info.max_texture_width;
+    size.y = info.max_texture_height;
+  }
+
+  return size;
+}
+
+// Pixel format with alpha the renderer takes without converting, images are decoded into it
+Uint32 LTexture::getTextureFormat()
+{
+  SDL_RendererInfo info;
+  if( SDL_GetRendererInfo( gRenderer, &info ) == 0 )
+  {
+    for( Uint32 i = 0; i < info.num_texture_formats; i++ )
+    {
+      if( SDL_ISPIXELFORMAT_ALPHA( info.texture_formats[ i ] ) && !SDL_ISPIXELFORMAT_FOURCC( info.texture_formats[ i ] ) )
+      {
+	return info.texture_formats[ i ];
+      }
+    }
+  }
+
+  return SDL_PIXELFORMAT_ARGB8888;
+}
+
+// Copy of a surface resized once to the output scale, or the surface itself at scale 1
+SDL_Surface* LTexture::rasterize( SDL_Surface* surface, SDL_Point maxSize, float& scale )
+{
+  scale = sScale;
+
+  // Stay within the largest texture the renderer can hold
+  if( maxSize.x > 0 && maxSize.y > 0 )
+  {
+    scale = fminf( scale, fminf( (float)maxSize.x / surface->w, (float)maxSize.y / surface->h ) );
+  }
+
+  if( scale == 1.0f )
+  {
+    return surface;
+  }
+
+  SDL_Surface* source = SDL_ConvertSurfaceFormat( surface, SDL_PIXELFORMAT_ARGB8888, 0 );
+  SDL_Surface* scaled = NULL;
+  if( source != NULL )
+  {
+    scaled = SDL_CreateRGBSurfaceWithFormat( 0, lroundf( surface->w * scale ), lroundf( surface->h * scale ), 32, SDL_PIXELFORMAT_ARGB8888 );
+  }
+
+  if( scaled != NULL )
+  {
+#if SDL_VERSION_ATLEAST( 2, 0, 16 )
+    SDL_SoftStretchLinear( source, NULL, scaled, NULL );
+#else
+    SDL_SetSurfaceBlendMode( source, SDL_BLENDMODE_NONE );
+    SDL_BlitScaled( source, NULL, scaled, NULL );
+#endif
+  }
+  else
+  {
+    printf( "Unable to rasterize image at scale %.2f! SDL Error: %s\n", scale, SDL_GetError() );
+    scale = 1.0f;
+    scaled = surface;
+  }
+
+  SDL_FreeSurface( source );
+
+  return scaled;
+}
+
+// Rect in screen pixels mapped onto the rasterized texture
+SDL_Rect LTexture::scaleRect( SDL_Rect& rect )
+{
+  SDL_Rect scaled;
+  scaled.x = lroundf( rect.x * mScale );
+  scaled.y = lroundf( rect.y * mScale );
+  scaled.w = lroundf( ( rect.x + rect.w ) * mScale ) - scaled.x;
+  scaled.h = lroundf( ( rect.y + rect.h ) * mScale ) - scaled.y;
+
+  return scaled;
 }
 
 // Access width
@@ -5,6 +5,8 @@
 #include <stdio.h>
 #include <string>
 
+#include "../globals/globals.h"
+
 // Texture wrapper class taken from Lazy Foo SDL tutorials: http://lazyfoo.net/tutorials/SDL/
 class LTexture
 {
@@ -13,19 +15,43 @@ class LTexture
   ~LTexture();
 
   bool loadFromFile( std::string path );
+  bool loadFromDecoded( DecodedImage& image, std::string path );
   bool loadFromRenderedText( std::string textureText, SDL_Color textColor );
+  bool createBlank( int width, int height, SDL_TextureAccess access = SDL_TEXTUREACCESS_TARGET, float scale = 1.0f );
   void free();
   void setBlendMode( SDL_BlendMode blending );
   void setAlpha( Uint8 alpha );
   void render( int x, int y, SDL_Rect* clip = NULL );
+  void renderScaled( SDL_Rect& quad, SDL_Rect* clip = NULL );
+  void updatePixels( SDL_Rect* rect, void* pixels, int pitch );
+  void setAsRenderTarget();
+  SDL_Rect scaleRect( SDL_Rect& rect );
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+  void renderGeometry( SDL_Vertex* vertices, int numVertices, int* indices, int numIndices );
+#endif
 
   int getWidth();
   int getHeight();
 
+  static void setScale( float scale );
+  static float getScale();
+
+  static bool decode( std::string path, SDL_Point maxSize, Uint32 format, DecodedImage& image );
+  static SDL_Point getMaxTextureSize();
+  static Uint32 getTextureFormat();
+
   private:
+  static SDL_Surface* rasterize( SDL_Surface* surface, SDL_Point maxSize, float& scale );
+
   SDL_Texture* mTexture;
   int mWidth;
   int mHeight;
+  Uint8 mAlpha;
+  float mScale;
+  Uint32 mVersion;
+
+  static float sScale;
+  static Uint32 sNextVersion;
 };
 
 #endif
@@ -0,0 +1,201 @@
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../AssetPack/AssetPack.h"
+#include "../LTexture/LTexture.h"
+#include "../textures/textures.h"
+#include "Minimap.h"
+
+// Initialize member variables
+Minimap::Minimap()
+{
+  mBoards = 0;
+  mFocus = -1;
+  mFrame = 0;
+  mFrameUploads = 0;
+  mRowUploads = 0;
+}
+
+// Create the atlas and take one colour per Square sprite from the block sheet
+bool Minimap::build( int boards )
+{
+  bool success = true;
+
+  mBoards = boards > MAX_MINIMAPS ? MAX_MINIMAPS : boards;
+
+  SDL_Surface* loadedSurface = IMG_Load_RW( gAssetPack.openFile( "images/blocks.png" ), 1 );
+  if( loadedSurface == NULL )
+  {
+    printf( "Failed to load minimap colours! SDL_image Error: %s\n", IMG_GetError() );
+    return false;
+  }
+
+  SDL_Surface* blocks = SDL_ConvertSurfaceFormat( loadedSurface, SDL_PIXELFORMAT_RGBA8888, 0 );
+  SDL_FreeSurface( loadedSurface );
+  if( blocks == NULL )
+  {
+    printf( "Failed to convert minimap colours! SDL Error: %s\n", SDL_GetError() );
+    return false;
+  }
+
+  SDL_LockSurface( blocks );
+  for( int i = 0; i < SQUARE_SPRITE_TOTAL; i++ )
+  {
+    int x = gSquareSpriteClips[ i ].x + ( gSquareSpriteClips[ i ].w / 2 );
+    int y = gSquareSpriteClips[ i ].y + ( gSquareSpriteClips[ i ].h / 2 );
+    mColors[ i ] = ( (Uint32*)( (Uint8*)blocks->pixels + ( y * blocks->pitch ) ) )[ x ];
+  }
+  SDL_UnlockSurface( blocks );
+  SDL_FreeSurface( blocks );
+
+  // Empty cells are a faint shadow so the board outline still reads
+  mColors[ SQUARE_SPRITE_BLANK ] = 0x00000040;
+
+  int atlasRows = ( MAX_MINIMAPS + MINIMAP_ATLAS_COLS - 1 ) / MINIMAP_ATLAS_COLS;
+  if( !mAtlas.createBlank( MINIMAP_ATLAS_COLS * TOTAL_COLS, atlasRows * MINIMAP_ROWS, SDL_TEXTUREACCESS_STREAMING ) )
+  {
+    success = false;
+  }
+  else
+  {
+    mAtlas.setBlendMode( SDL_BLENDMODE_BLEND );
+
+    Uint8 blank[ TOTAL_SQUARES ];
+    memset( blank, SQUARE_SPRITE_BLANK, sizeof( blank ) );
+
+    for( int i = 0; i < mBoards; i++ )
+    {
+      mClips[ i ].x = ( i % MINIMAP_ATLAS_COLS ) * TOTAL_COLS;
+      mClips[ i ].y = ( i / MINIMAP_ATLAS_COLS ) * MINIMAP_ROWS;
+      mClips[ i ].w = TOTAL_COLS;
+      mClips[ i ].h = MINIMAP_ROWS;
+
+      for( int row = 0; row < MINIMAP_ROWS; row++ )
+      {
+	uploadRow( i, row, blank );
+      }
+      memcpy( mCells[ i ], blank, sizeof( blank ) );
+    }
+  }
+
+  return success;
+}
+
+void Minimap::free()
+{
+  mAtlas.free();
+  mBoards = 0;
+}
+
+// Place boards in a grid over the screen, skipping anything touching one of the avoided Rects
+void Minimap::layout( SDL_Rect& screen, SDL_Rect* avoid, int avoidCount, int scale )
+{
+  int w = TOTAL_COLS * scale;
+  int h = MINIMAP_ROWS * scale;
+  int gap = scale * 2;
+  int placed = 0;
+
+  for( int y = screen.y + gap; y + h <= screen.y + screen.h && placed < mBoards; y += h + gap )
+  {
+    for( int x = screen.x + gap; x + w <= screen.x + screen.w && placed < mBoards; x += w + gap )
+    {
+      SDL_Rect area = { x, y, w, h };
+      bool blocked = false;
+      for( int i = 0; i < avoidCount && !blocked; i++ )
+      {
+	blocked = SDL_HasIntersection( &area, &avoid[ i ] );
+      }
+
+      if( blocked )
+      {
+	continue;
+      }
+
+      mAreas[ placed ] = area;
+      placed++;
+    }
+  }
+
+  // Boards that did not fit are not drawn
+  mBoards = placed;
+}
+
+// The focused board is refreshed every frame, the rest less often
+void Minimap::setFocus( int board )
+{
+  if( board < 0 || board >= mBoards )
+  {
+    return;
+  }
+
+  mFocus = board;
+}
+
+// Send the rows of a board that changed since its last refresh
+void Minimap::update( int board, Uint8* squareSprites )
+{
+  if( board < 0 || board >= mBoards )
+  {
+    return;
+  }
+
+  // Stagger boards out of focus so their uploads spread over frames
+  if( board != mFocus && ( mFrame + board ) % MINIMAP_UNFOCUSED_INTERVAL != 0 )
+  {
+    return;
+  }
+
+  for( int row = 0; row < MINIMAP_ROWS; row++ )
+  {
+    int first = ( row + 2 ) * TOTAL_COLS;
+    if( memcmp( &mCells[ board ][ first ], &squareSprites[ first ], TOTAL_COLS ) != 0 )
+    {
+      memcpy( &mCells[ board ][ first ], &squareSprites[ first ], TOTAL_COLS );
+      uploadRow( board, row, &squareSprites[ first ] );
+    }
+  }
+}
+
+// Queue every board from the one atlas so they submit as a single batch
+void Minimap::render()
+{
+  gRenderQueue.setLayer( RENDER_LAYER_MINIMAP );
+
+  for( int i = 0; i < mBoards; i++ )
+  {
+    mAtlas.renderScaled( mAreas[ i ], &mClips[ i ] );
+  }
+
+  mRowUploads = mFrameUploads;
+  mFrameUploads = 0;
+  mFrame++;
+}
+
+int Minimap::getBoardCount()
+{
+  return mBoards;
+}
+
+// Rows uploaded during the last rendered frame
+int Minimap::getRowUploads()
+{
+  return mRowUploads;
+}
+
+// Convert one row of sprites to colours and copy it into the atlas
+void Minimap::uploadRow( int board, int row, Uint8* sprites )
+{
+  Uint32 pixels[ TOTAL_COLS ];
+  for( int i = 0; i < TOTAL_COLS; i++ )
+  {
+    pixels[ i ] = mColors[ sprites[ i ] ];
+  }
+
+  SDL_Rect rect = { mClips[ board ].x, mClips[ board ].y + row, TOTAL_COLS, 1 };
+  mAtlas.updatePixels( &rect, pixels, sizeof( pixels ) );
+  mFrameUploads++;
+}
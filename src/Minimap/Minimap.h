@@ -0,0 +1,42 @@
+#ifndef MINIMAP_H
+#define MINIMAP_H
+
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+#include "../LTexture/LTexture.h"
+
+// Many small boards kept as one pixel per Square in a shared atlas texture
+class Minimap
+{
+  public:
+  Minimap();
+
+  bool build( int boards );
+  void free();
+  void layout( SDL_Rect& screen, SDL_Rect* avoid, int avoidCount, int scale );
+  void setFocus( int board );
+  void update( int board, Uint8* squareSprites );
+  void render();
+
+  int getBoardCount();
+  int getRowUploads();
+
+  private:
+  void uploadRow( int board, int row, Uint8* sprites );
+
+  LTexture mAtlas;
+  Uint32 mColors[ SQUARE_SPRITE_TOTAL ];
+  Uint8 mCells[ MAX_MINIMAPS ][ TOTAL_SQUARES ];
+  SDL_Rect mClips[ MAX_MINIMAPS ];
+  SDL_Rect mAreas[ MAX_MINIMAPS ];
+  int mBoards;
+  int mFocus;
+  Uint32 mFrame;
+
+  // Rows sent to the atlas in the current and last frame
+  int mFrameUploads;
+  int mRowUploads;
+};
+
+#endif
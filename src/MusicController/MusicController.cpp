@@ -0,0 +1,121 @@
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+#include <stdio.h>
+
+#include "MusicController.h"
+
+MusicController gMusicController;
+SDL_atomic_t MusicController::sFinished;
+
+// Initialize member variables
+MusicController::MusicController()
+{
+  mCurrent = NULL;
+  mNext = NULL;
+  mNextLoops = 0;
+  mNextFadeIn = 0;
+  mStopping = false;
+}
+
+// Listen for the music stream finishing, once the mixer is open
+void MusicController::init()
+{
+  SDL_AtomicSet( &sFinished, 0 );
+  Mix_HookMusicFinished( finished );
+}
+
+// Forget every track after the device was reopened, which stopped the music
+void MusicController::reset()
+{
+  mCurrent = NULL;
+  mNext = NULL;
+  mStopping = false;
+  init();
+}
+
+// Make a track the one playing. Asking for the current track does nothing,
+// otherwise the current one fades out over fadeOut ms, or stops at once,
+// and the new one fades in over fadeIn ms as soon as it has.
+void MusicController::request( Mix_Music* music, int loops, int fadeOut, int fadeIn )
+{
+  if( music == NULL || ( mStopping ? mNext : mCurrent ) == music )
+  {
+    return;
+  }
+
+  mNext = music;
+  mNextLoops = loops;
+  mNextFadeIn = fadeIn;
+
+  if( mCurrent == NULL )
+  {
+    startNext();
+  }
+  else if( !mStopping )
+  {
+    stopCurrent( fadeOut );
+  }
+}
+
+// Fade the current track to silence without anything after it
+void MusicController::fadeOut( int ms )
+{
+  mNext = NULL;
+
+  if( mCurrent != NULL && !mStopping )
+  {
+    stopCurrent( ms );
+  }
+}
+
+// Start whatever is waiting once the mixer said the last track ended.
+// Called once per logic step.
+void MusicController::update()
+{
+  if( SDL_AtomicSet( &sFinished, 0 ) == 0 )
+  {
+    return;
+  }
+
+  mCurrent = NULL;
+  mStopping = false;
+
+  if( mNext != NULL )
+  {
+    startNext();
+  }
+}
+
+// Runs on the audio thread, where SDL_mixer must not be called back into
+void MusicController::finished()
+{
+  SDL_AtomicSet( &sFinished, 1 );
+}
+
+// Both a finished fade and a halt report back through finished()
+void MusicController::stopCurrent( int fadeOut )
+{
+  mStopping = true;
+
+  // A track that already went quiet has nothing left to report
+  if( Mix_PlayingMusic() == 0 )
+  {
+    SDL_AtomicSet( &sFinished, 1 );
+  }
+  else if( fadeOut <= 0 || Mix_FadeOutMusic( fadeOut ) == 0 )
+  {
+    Mix_HaltMusic();
+  }
+}
+
+void MusicController::startNext()
+{
+  mCurrent = mNext;
+  mNext = NULL;
+
+  if( Mix_FadeInMusic( mCurrent, mNextLoops, mNextFadeIn ) < 0 )
+  {
+    printf( "Unable to play music! SDL_mixer Error: %s\n", Mix_GetError() );
+    mCurrent = NULL;
+  }
+}
@@ -0,0 +1,38 @@
+#ifndef MUSICCONTROLLER_H
+#define MUSICCONTROLLER_H
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+// Switches the music stream between tracks. A track asked for while another
+// plays is started the moment SDL_mixer reports the old one finished, so
+// game states never poll the mixer.
+class MusicController
+{
+  public:
+  MusicController();
+
+  void init();
+  void reset();
+  void request( Mix_Music* music, int loops, int fadeOut, int fadeIn );
+  void fadeOut( int ms );
+  void update();
+
+  private:
+  static void finished();
+  void stopCurrent( int fadeOut );
+  void startNext();
+
+  Mix_Music* mCurrent;
+  Mix_Music* mNext;
+  int mNextLoops;
+  int mNextFadeIn;
+  bool mStopping;
+
+  // Set by the mixer when the music stream goes quiet
+  static SDL_atomic_t sFinished;
+};
+
+extern MusicController gMusicController;
+
+#endif
@@ -0,0 +1,129 @@
+#include <SDL2/SDL.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "ParticleSystem.h"
+
+// Random float between 0 and 1
+static float randomUnit()
+{
+  return (float)rand() / RAND_MAX;
+}
+
+// Start with an empty pool, zeroed so padded updates only touch plain numbers
+ParticleSystem::ParticleSystem()
+{
+  memset( &mParticles, 0, sizeof( mParticles ) );
+  memset( mLife, 0, sizeof( mLife ) );
+  memset( mMaxLife, 0, sizeof( mMaxLife ) );
+}
+
+// Spawn a burst at (x,y) in grid cells, thinned out as the pool fills
+void ParticleSystem::emit( float x, float y, int sprite, int count, float speed, float life, int size )
+{
+  int available = PARTICLE_CAPACITY - mParticles.count;
+  int requested = count;
+
+  if( available < PARTICLE_CAPACITY / 2 )
+  {
+    count = count * 2 * available / PARTICLE_CAPACITY;
+  }
+  if( count > available )
+  {
+    count = available;
+  }
+  mParticles.dropped += requested - count;
+
+  for( int i = 0; i < count; i++ )
+  {
+    int p = mParticles.count++;
+    float angle = randomUnit() * 2.0f * (float)M_PI;
+    float v = speed * ( 0.5f + randomUnit() );
+
+    mParticles.x[ p ] = x;
+    mParticles.y[ p ] = y;
+    mParticles.vx[ p ] = cosf( angle ) * v;
+    mParticles.vy[ p ] = sinf( angle ) * v - speed;
+    mParticles.sprite[ p ] = sprite;
+    mParticles.alpha[ p ] = 255;
+    mParticles.size[ p ] = size;
+    mLife[ p ] = life * ( 0.75f + randomUnit() / 2.0f );
+    mMaxLife[ p ] = mLife[ p ];
+  }
+}
+
+// Advance every particle by one logic step and drop the expired ones
+void ParticleSystem::update()
+{
+  Uint64 start = SDL_GetPerformanceCounter();
+
+  const float dt = 1.0f / LOGIC_TICKS_PER_SECOND;
+  int n = mParticles.count;
+
+  // Plain loops over separate arrays so the compiler can vectorize them.
+  // Rounding up to a multiple of 8 lets them run without a scalar tail;
+  // the extra slots are unused and PARTICLE_CAPACITY is a multiple of 8.
+  int padded = ( n + 7 ) & ~7;
+  for( int i = 0; i < padded; i++ )
+  {
+    mParticles.vy[ i ] += PARTICLE_GRAVITY * dt;
+  }
+  for( int i = 0; i < padded; i++ )
+  {
+    mParticles.x[ i ] += mParticles.vx[ i ] * dt;
+    mParticles.y[ i ] += mParticles.vy[ i ] * dt;
+  }
+  for( int i = 0; i < padded; i++ )
+  {
+    mLife[ i ] -= dt;
+  }
+
+  int alive = 0;
+  for( int i = 0; i < n; i++ )
+  {
+    if( mLife[ i ] > 0.0f )
+    {
+      mParticles.x[ alive ] = mParticles.x[ i ];
+      mParticles.y[ alive ] = mParticles.y[ i ];
+      mParticles.vx[ alive ] = mParticles.vx[ i ];
+      mParticles.vy[ alive ] = mParticles.vy[ i ];
+      mParticles.sprite[ alive ] = mParticles.sprite[ i ];
+      mParticles.size[ alive ] = mParticles.size[ i ];
+      mParticles.alpha[ alive ] = (Uint8)( 255.0f * mLife[ i ] / mMaxLife[ i ] );
+      mLife[ alive ] = mLife[ i ];
+      mMaxLife[ alive ] = mMaxLife[ i ];
+      alive++;
+    }
+  }
+  mParticles.count = alive;
+
+  mParticles.updateTime = (float)( SDL_GetPerformanceCounter() - start ) * 1000.0f / SDL_GetPerformanceFrequency();
+}
+
+// Remove all particles
+void ParticleSystem::clear()
+{
+  mParticles.count = 0;
+  mParticles.dropped = 0;
+  mParticles.updateTime = 0.0f;
+}
+
+// Copy the live particles for the renderer
+void ParticleSystem::snapshot( ParticleBuffer& p )
+{
+  int n = mParticles.count;
+
+  p.count = n;
+  p.dropped = mParticles.dropped;
+  p.updateTime = mParticles.updateTime;
+  memcpy( p.x, mParticles.x, n * sizeof( float ) );
+  memcpy( p.y, mParticles.y, n * sizeof( float ) );
+  memcpy( p.vx, mParticles.vx, n * sizeof( float ) );
+  memcpy( p.vy, mParticles.vy, n * sizeof( float ) );
+  memcpy( p.sprite, mParticles.sprite, n );
+  memcpy( p.alpha, mParticles.alpha, n );
+  memcpy( p.size, mParticles.size, n );
+}
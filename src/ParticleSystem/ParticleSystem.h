@@ -0,0 +1,26 @@
+#ifndef PARTICLESYSTEM_H
+#define PARTICLESYSTEM_H
+
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+
+// Fixed capacity pool of short lived particles, stepped with the game logic
+class ParticleSystem
+{
+  public:
+  ParticleSystem();
+
+  void emit( float x, float y, int sprite, int count, float speed, float life, int size );
+  void update();
+  void clear();
+  void snapshot( ParticleBuffer& p );
+
+  private:
+  ParticleBuffer mParticles;
+  float mLife[ PARTICLE_CAPACITY ];
+  float mMaxLife[ PARTICLE_CAPACITY ];
+};
+
+#endif
@@ -1,32 +1,63 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_mixer.h>
 #include <stdio.h>
-#include <string>
+#include <stdlib.h>
+#include <string.h>
 
 #include "../constants.h"
 #include "../globals/globals.h"
-#include "../LTexture/LTexture.h"
-#include "../textures/textures.h"
 #include "../Timer/Timer.h"
 #include "../Square/Square.h"
 #include "../Tetromino/Tetromino.h"
 #include "../GameState/GameState.h"
+#include "../AudioLoader/AudioLoader.h"
+#include "../MusicController/MusicController.h"
+#include "../VoiceManager/VoiceManager.h"
 #include "../functions/functions.h"
 #include "Play.h"
 
-Play::Play( Stats* stats, Square* gridSquares, Square** nextSquares, Square** holdSquares, SDL_Rect* statAreas )
+Play::Play( Stats* stats, Square* gridSquares, ParticleSystem* particles )
 {
+  mParticles = particles;
   mStats = stats;
+  mGridSquares = gridSquares;
+  mTetromino = NULL;
+
+  mStarted = false;
+  mPaused = false;
+  mHolding = false;
+
+  mClearing = false;
+  mTetris = false;
+
+  mNextState = GAME_STATE_NULL;
+}
+
+Play::~Play()
+{
+  exit();
+
+  mStats = NULL;
+  mGridSquares = NULL;
+}
+
+// Start a new game
+void Play::enter()
+{
+  mNextState = GAME_STATE_NULL;
+
   mStats->holdTetromino = TETROMINO_NULL;
   mStats->score = 0;
   mStats->lines = 0;
   mStats->level = 1;
   mStats->currentBG = rand() % TOTAL_BG;
   mStats->currentBGM = rand() % TOTAL_BGM;
-
-  mGridSquares = gridSquares;
-  mNextSquares = nextSquares;
-  mHoldSquares = holdSquares;
+  mStats->pieces = 0;
+  mStats->keys = 0;
+  mStats->holds = 0;
+  memset( mStats->clears, 0, sizeof( mStats->clears ) );
+  mStats->steps = 0;
+  memset( mStats->levelSteps, 0, sizeof( mStats->levelSteps ) );
 
   TetrominoFlag first = randomTetromino( TETROMINO_NULL );
   if( !createTetromino( first ) )
@@ -36,43 +67,28 @@ Play::Play( Stats* stats, Square* gridSquares, Square** nextSquares, Square** ho
   }
   else
   {
-    mStats->nextTetrominoes[ 1 ] = randomTetromino( first );
-    mStats->nextTetrominoes[ 2 ] = randomTetromino( mStats->nextTetrominoes[ 1 ] );
+    TetrominoFlag previous = first;
+    for( int i = 1; i < NEXT_QUEUE_SIZE; i++ )
+    {
+      mStats->nextTetrominoes[ i ] = randomTetromino( previous );
+      previous = mStats->nextTetrominoes[ i ];
+    }
     updateNext();
   }
-  
-  for( int i = 0; i < 3; i++ )
-  {
-    mStatCenters[ i ].x = statAreas[ i ].x + ( statAreas[ i ].w / 2 );
-    mStatCenters[ i ].y = statAreas[ i ].y + ( statAreas[ i ].h / 2 );
-    mStatPositions[ i ] = mStatCenters[ i ];
-  }
 
   mStarted = false;
   mPaused = false;
   mHolding = false;
-  mStatsChanged = true;
 
   mClearing = false;
   mTetris = false;
 
-  for( int i = 0; i < TOTAL_BG; i++ )
-  {
-    gBGTextures[ i ].setAlpha( 255 );
-  }
-
-  mNextState = GAME_STATE_NULL;
-
   mTimer.start();
 }
 
-Play::~Play()
+// Drop the piece left over when the game ended
+void Play::exit()
 {
-  mStats = NULL;
-  mGridSquares = NULL;
-  mNextSquares = NULL;
-  mHoldSquares = NULL;
- 
   if( mTetromino != NULL )
   {
     delete mTetromino;
@@ -93,21 +109,30 @@ void Play::handleEvent( SDL_Event& e )
 	  mPaused = false;
 	  mTimer.unpause();
 	  Mix_Resume( -1 );
+	  Mix_ResumeMusic();
 	}
 	else
 	{
 	  mPaused = true;
 	  mTimer.pause();
 	  Mix_Pause( -1 );
+	  Mix_PauseMusic();
 	}
       }
       else if( !mPaused && !mClearing )
       {
+	// Every fresh press of a key the game uses counts, accepted or not
+	if( e.key.repeat == 0 && isGameKey( e.key.keysym.sym ) )
+	{
+	  mStats->keys++;
+	}
+
 	if( e.key.keysym.sym == SDLK_c )
 	{
-	  if( !mHolding )
+	  if( !mHolding && mTetromino != NULL )
 	  {
 	    mHolding = true;
+	    mStats->holds++;
 
 	    TetrominoFlag next;
 
@@ -131,21 +156,17 @@ void Play::handleEvent( SDL_Event& e )
 	    {
 	      mNextState = GAME_STATE_GAMEOVER;
 	    }
-	    else
-	    {
-	      updateHold();
-	    }
 
-	    Mix_PlayChannel( MIX_CHANNEL_HOLD, gHoldSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_HOLD );
 	  }
 	}
-	else
+	else if( mTetromino != NULL )
 	{
 	  mTetromino->handleEvent( e );
 	}
       }
     }
-    else if( e.type == SDL_KEYUP )
+    else if( e.type == SDL_KEYUP && mTetromino != NULL )
     {
       mTetromino->handleEvent( e );
     }
@@ -160,6 +181,12 @@ void Play::logic()
     // If the game is not paused
     if( !mPaused )
     {
+      mParticles->update();
+
+      // Time on the levels past the last tracked one is added to it
+      mStats->steps++;
+      mStats->levelSteps[ ( mStats->level < STATS_TRACKED_LEVELS ? mStats->level : STATS_TRACKED_LEVELS ) - 1 ]++;
+
       // If lines are being cleared
       if( mClearing )
       {
@@ -181,6 +208,11 @@ void Play::logic()
 	    {
 	      for( int j = i; j < i + TOTAL_COLS; j++ )
 	      {
+		// Shatter the Square into pieces of its own colour
+		float x = ( j % TOTAL_COLS ) + 0.5f;
+		float y = ( j / TOTAL_COLS ) + 0.5f;
+		mParticles->emit( x, y, mGridSquares[ j ].getSprite(), 6, 4.0f, 0.8f, 8 );
+
 		mGridSquares[ j ].clear();
 	      }
 	    }
@@ -236,9 +268,10 @@ void Play::logic()
 	if( mTetromino != NULL && !( mTetromino->fall() ) )
 	{
 	  delete mTetromino;
+	  mTetromino = NULL;
 	  
 	  mStats->score += 10 * mStats->level;
-	  mStatsChanged = true;
+	  mStats->pieces++;
 
 	  if( mHolding )
 	  {
@@ -269,6 +302,7 @@ void Play::logic()
 	  {
 	    mClearing = true;
 	    mStats->lines += lines;
+	    mStats->clears[ lines - 1 ]++;
 
 	    switch( lines )
 	    {
@@ -291,11 +325,33 @@ void Play::logic()
 
 	    if( mTetris )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_TETRIS, gTetrisSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_TETRIS );
+
+	      // Sparks along the four full rows
+	      for( int i = 0; i < TOTAL_SQUARES; i += TOTAL_COLS )
+	      {
+		bool rowFilled = true;
+
+		for( int j = i; j < i + TOTAL_COLS; j++ )
+		{
+		  if( mGridSquares[ j ].getState() != SQUARE_STATE_STILL )
+		  {
+		    rowFilled = false;
+		  }
+		}
+
+		if( rowFilled )
+		{
+		  for( int j = i; j < i + TOTAL_COLS; j++ )
+		  {
+		    mParticles->emit( ( j % TOTAL_COLS ) + 0.5f, ( j / TOTAL_COLS ) + 0.5f, mGridSquares[ j ].getSprite(), 3, 8.0f, 0.5f, 4 );
+		  }
+		}
+	      }
 	    }
 	    else
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_CLEAR, gClearSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_CLEAR );
 	    }
 
 	    int level = mStats->lines / 10;
@@ -321,8 +377,6 @@ void Play::logic()
 	      }
 
 	      mStats->currentBG = nextBG;
-
-	      Mix_FadeOutChannel( MIX_CHANNEL_MUSIC, 500 );
 	    }
 
 	    mTimer.start();
@@ -340,9 +394,12 @@ void Play::logic()
 	  }
 	}
 
-	if( Mix_Playing( MIX_CHANNEL_MUSIC ) == 0 )
+	// On a new level the last track fades to silence over 500 ms, then the
+	// new one fades in over 500 ms. There is one music stream, so the two
+	// never overlap.
+	if( gAudioLoader.isReady( (AudioAsset)( AUDIO_ASSET_BGM + mStats->currentBGM ) ) )
 	{
-	  Mix_PlayChannel( MIX_CHANNEL_MUSIC, gBGMusic[ mStats->currentBGM ], - 1 );
+	  gMusicController.request( gBGMusic[ mStats->currentBGM ], -1, 500, 500 );
 	}
       }
     }
@@ -356,347 +413,38 @@ void Play::logic()
       mTimer.start();
     }
 
-    if( Mix_Playing( MIX_CHANNEL_MUSIC ) == 1 )
-    {
-      Mix_FadeOutChannel( MIX_CHANNEL_MUSIC, 2000 );
-    }
+    gMusicController.fadeOut( 2000 );
   }
 }
 
-void Play::render()
+void Play::snapshot( FrameSnapshot& s )
 {
-  int currentTicks = mTimer.getTicks();
-
-  // If the game has started
-  if( mStarted )
-  {
-    gBGTextures[ mStats->currentBG ].render( 0, 0 );
-
-    // If lines are being cleared
-    if( mClearing )
-    {
-      gBlackTexture.setAlpha( 255 * currentTicks / 500 );
-      gBlackTexture.render( 0, 0 );
-
-      int frame = 4;
-
-      if( currentTicks < 250 )
-      {
-	frame = currentTicks / 50;
-      }
-
-      gHandWhiteTexture.render( 0, 0, &gHandClips[ frame ] );
-      gHandWhiteTexture.render( 0, 275, &gHandClips[ frame ] );
-
-      if( currentTicks < 500 )
-      {
-	for( int i = 0; i < TOTAL_SQUARES; i += TOTAL_COLS )
-	{
-	  bool rowFilled = true;
+  s.ticks = mTimer.getTicks();
+  s.pauseTicks = mTimer.getPauseTicks();
 
-	  for( int j = i; j < i + TOTAL_COLS; j++ )
-	  {
-	    if( mGridSquares[ j ].getState() != SQUARE_STATE_STILL )
-	    {
-	      rowFilled = false;
-	    }
-	  }
-
-	  if( rowFilled )
-	  {
-	    for( int j = i; j < i + TOTAL_COLS; j++ )
-	    {
-	      mGridSquares[ j ].setAlpha( 255 - ( 255 * currentTicks / 500 ) );
-	    }
-	  }
-	}
-      }
-    }
-      
-    gPlayBGTexture.render( 0, 0 );
-
-    // If player got a tetris
-    if( mTetris )
-    {
-      gTetrisTexture.setAlpha( 255 * ( currentTicks % 100 ) / 100 );
-      gTetrisTexture.render( 0, 0 );
-    }
-
-    SDL_Color textColor = { 0, 0, 0 };
-
-    // If stats need to be updated
-    if( mStatsChanged )
-    {
-      std::string score = std::to_string( mStats->score );
-      gScoreTextTexture.loadFromRenderedText( score.c_str(), textColor );
-      mStatPositions[ 0 ].x = mStatCenters[ 0 ].x - ( gScoreTextTexture.getWidth() / 2 );
-      mStatPositions[ 0 ].y = mStatCenters[ 0 ].y - ( gScoreTextTexture.getHeight() / 2 );
-
-      std::string lines = std::to_string( mStats->lines );
-      gLinesTextTexture.loadFromRenderedText( lines.c_str(), textColor );
-      mStatPositions[ 1 ].x = mStatCenters[ 1 ].x - ( gLinesTextTexture.getWidth() / 2 );
-      mStatPositions[ 1 ].y = mStatCenters[ 1 ].y - ( gLinesTextTexture.getHeight() / 2 );
-
-      std::string level = std::to_string( mStats->level );
-      gLevelTextTexture.loadFromRenderedText( level.c_str(), textColor );
-      mStatPositions[ 2 ].x = mStatCenters[ 2 ].x - ( gLevelTextTexture.getWidth() / 2 );
-      mStatPositions[ 2 ].y = mStatCenters[ 2 ].y - ( gLevelTextTexture.getHeight() / 2 );
-
-      mStatsChanged = false;
-    }
-
-    gScoreTextTexture.render( mStatPositions[ 0 ].x, mStatPositions[ 0 ].y );
-    gLinesTextTexture.render( mStatPositions[ 1 ].x, mStatPositions[ 1 ].y );
-    gLevelTextTexture.render( mStatPositions[ 2 ].x, mStatPositions[ 2 ].y );
-
-    switch( mStats->nextTetrominoes[ 0 ] )
-    {
-      case TETROMINO_I:
-	mNextSquares[ 0 ][ 4 ].render();
-	mNextSquares[ 0 ][ 5 ].render();
-	mNextSquares[ 0 ][ 6 ].render();
-	mNextSquares[ 0 ][ 7 ].render();
-	break;
-
-      case TETROMINO_J:
-	mNextSquares[ 1 ][ 0 ].render();
-	mNextSquares[ 1 ][ 3 ].render();
-	mNextSquares[ 1 ][ 4 ].render();
-	mNextSquares[ 1 ][ 5 ].render();
-	break;
-
-      case TETROMINO_L:
-	mNextSquares[ 1 ][ 2 ].render();
-	mNextSquares[ 1 ][ 3 ].render();
-	mNextSquares[ 1 ][ 4 ].render();
-	mNextSquares[ 1 ][ 5 ].render();
-	break;
-
-      case TETROMINO_O:
-	mNextSquares[ 0 ][ 1 ].render();
-	mNextSquares[ 0 ][ 2 ].render();
-	mNextSquares[ 0 ][ 5 ].render();
-	mNextSquares[ 0 ][ 6 ].render();
-	break;
-
-      case TETROMINO_S:
-	mNextSquares[ 1 ][ 1 ].render();
-	mNextSquares[ 1 ][ 2 ].render();
-	mNextSquares[ 1 ][ 3 ].render();
-	mNextSquares[ 1 ][ 4 ].render();
-	break;
-
-      case TETROMINO_T:
-	mNextSquares[ 1 ][ 1 ].render();
-	mNextSquares[ 1 ][ 3 ].render();
-	mNextSquares[ 1 ][ 4 ].render();
-	mNextSquares[ 1 ][ 5 ].render();
-	break;
-
-      case TETROMINO_Z:
-	mNextSquares[ 1 ][ 0 ].render();
-	mNextSquares[ 1 ][ 1 ].render();
-	mNextSquares[ 1 ][ 4 ].render();
-	mNextSquares[ 1 ][ 5 ].render();
-	break;
-
-      default:
-	mNextState = GAME_STATE_ERROR;
-    }
+  snapshotGrid( s, mGridSquares );
 
-    switch( mStats->nextTetrominoes[ 1 ] )
-    {
-      case TETROMINO_I:
-	mNextSquares[ 2 ][ 4 ].render();
-	mNextSquares[ 2 ][ 5 ].render();
-	mNextSquares[ 2 ][ 6 ].render();
-	mNextSquares[ 2 ][ 7 ].render();
-	break;
-
-      case TETROMINO_J:
-	mNextSquares[ 3 ][ 0 ].render();
-	mNextSquares[ 3 ][ 3 ].render();
-	mNextSquares[ 3 ][ 4 ].render();
-	mNextSquares[ 3 ][ 5 ].render();
-	break;
-
-      case TETROMINO_L:
-	mNextSquares[ 3 ][ 2 ].render();
-	mNextSquares[ 3 ][ 3 ].render();
-	mNextSquares[ 3 ][ 4 ].render();
-	mNextSquares[ 3 ][ 5 ].render();
-	break;
-
-      case TETROMINO_O:
-	mNextSquares[ 2 ][ 1 ].render();
-	mNextSquares[ 2 ][ 2 ].render();
-	mNextSquares[ 2 ][ 5 ].render();
-	mNextSquares[ 2 ][ 6 ].render();
-	break;
-
-      case TETROMINO_S:
-	mNextSquares[ 3 ][ 1 ].render();
-	mNextSquares[ 3 ][ 2 ].render();
-	mNextSquares[ 3 ][ 3 ].render();
-	mNextSquares[ 3 ][ 4 ].render();
-	break;
-
-      case TETROMINO_T:
-	mNextSquares[ 3 ][ 1 ].render();
-	mNextSquares[ 3 ][ 3 ].render();
-	mNextSquares[ 3 ][ 4 ].render();
-	mNextSquares[ 3 ][ 5 ].render();
-	break; 
-
-      case TETROMINO_Z:
-	mNextSquares[ 3 ][ 0 ].render();
-	mNextSquares[ 3 ][ 1 ].render();
-	mNextSquares[ 3 ][ 4 ].render();
-	mNextSquares[ 3 ][ 5 ].render();
-	break;
-
-      default:
-	mNextState = GAME_STATE_ERROR;
-    }
-
-    switch( mStats->nextTetrominoes[ 2 ] )
-    {
-      case TETROMINO_I:
-	mNextSquares[ 4 ][ 4 ].render();
-	mNextSquares[ 4 ][ 5 ].render();
-	mNextSquares[ 4 ][ 6 ].render();
-	mNextSquares[ 4 ][ 7 ].render();
-	break;
-
-      case TETROMINO_J:
-	mNextSquares[ 5 ][ 0 ].render();
-	mNextSquares[ 5 ][ 3 ].render();
-	mNextSquares[ 5 ][ 4 ].render();
-	mNextSquares[ 5 ][ 5 ].render();
-	break;
-
-      case TETROMINO_L:
-	mNextSquares[ 5 ][ 2 ].render();
-	mNextSquares[ 5 ][ 3 ].render();
-	mNextSquares[ 5 ][ 4 ].render();
-	mNextSquares[ 5 ][ 5 ].render();
-	break;
-
-      case TETROMINO_O:
-	mNextSquares[ 4 ][ 1 ].render();
-	mNextSquares[ 4 ][ 2 ].render();
-	mNextSquares[ 4 ][ 5 ].render();
-	mNextSquares[ 4 ][ 6 ].render();
-	break;
-
-      case TETROMINO_S:
-	mNextSquares[ 5 ][ 1 ].render();
-	mNextSquares[ 5 ][ 2 ].render();
-	mNextSquares[ 5 ][ 3 ].render();
-	mNextSquares[ 5 ][ 4 ].render();
-	break;
-
-      case TETROMINO_T:
-	mNextSquares[ 5 ][ 1 ].render();
-	mNextSquares[ 5 ][ 3 ].render();
-	mNextSquares[ 5 ][ 4 ].render();
-	mNextSquares[ 5 ][ 5 ].render();
-	break;
-
-      case TETROMINO_Z:
-	mNextSquares[ 5 ][ 0 ].render();
-	mNextSquares[ 5 ][ 1 ].render();
-	mNextSquares[ 5 ][ 4 ].render();
-	mNextSquares[ 5 ][ 5 ].render();
-	break;
-
-      default:
-	mNextState = GAME_STATE_ERROR;
-    }
-
-    switch( mStats->holdTetromino )
-    {
-      case TETROMINO_NULL:
-	break;
-
-      case TETROMINO_I:
-	mHoldSquares[ 0 ][ 4 ].render();
-	mHoldSquares[ 0 ][ 5 ].render();
-	mHoldSquares[ 0 ][ 6 ].render();
-	mHoldSquares[ 0 ][ 7 ].render();
-	break;
-
-      case TETROMINO_J:
-	mHoldSquares[ 1 ][ 0 ].render();
-	mHoldSquares[ 1 ][ 3 ].render();
-	mHoldSquares[ 1 ][ 4 ].render();
-	mHoldSquares[ 1 ][ 5 ].render();
-	break;
-
-      case TETROMINO_L:
-	mHoldSquares[ 1 ][ 2 ].render();
-	mHoldSquares[ 1 ][ 3 ].render();
-	mHoldSquares[ 1 ][ 4 ].render();
-	mHoldSquares[ 1 ][ 5 ].render();
-	break;
-
-      case TETROMINO_O:
-	mHoldSquares[ 0 ][ 1 ].render();
-	mHoldSquares[ 0 ][ 2 ].render();
-	mHoldSquares[ 0 ][ 5 ].render();
-	mHoldSquares[ 0 ][ 6 ].render();
-	break;
-
-      case TETROMINO_S:
-	mHoldSquares[ 1 ][ 1 ].render();
-	mHoldSquares[ 1 ][ 2 ].render();
-	mHoldSquares[ 1 ][ 3 ].render();
-	mHoldSquares[ 1 ][ 4 ].render();
-	break;
-
-      case TETROMINO_T:
-	mHoldSquares[ 1 ][ 1 ].render();
-	mHoldSquares[ 1 ][ 3 ].render();
-	mHoldSquares[ 1 ][ 4 ].render();
-	mHoldSquares[ 1 ][ 5 ].render();
-	break;
-
-      case TETROMINO_Z:
-	mHoldSquares[ 1 ][ 0 ].render();
-	mHoldSquares[ 1 ][ 1 ].render();
-	mHoldSquares[ 1 ][ 4 ].render();
-	mHoldSquares[ 1 ][ 5 ].render();
-	break;
-
-      default:
-	mNextState = GAME_STATE_ERROR;
-    } 
-
-    for( int i = ( 2 * TOTAL_COLS ); i < TOTAL_SQUARES; i++ )
-    {
-      if( mGridSquares[ i ].getState() != SQUARE_STATE_BLANK )
-      {
-	mGridSquares[ i ].render();
-      }
-    }
-
-    // If the game is paused
-    if( mPaused )
+  if( mTetromino != NULL )
+  {
+    mTetromino->getPositions( s.piecePositions );
+    mTetromino->getGhostPositions( s.ghostPositions );
+    s.pieceFell = mTetromino->justFell();
+  }
+  else
+  {
+    for( int i = 0; i < 4; i++ )
     {
-      int pauseTicks = mTimer.getPauseTicks();
-      gPausedTexture.setAlpha( 255 - ( 255 * ( ( pauseTicks % 2000 ) - 1000 ) * ( ( pauseTicks % 2000 ) - 1000 ) / 1000000 ) );
-      gPausedTexture.render( 0, 0 );
+      s.piecePositions[ i ] = -1;
+      s.ghostPositions[ i ] = -1;
     }
+    s.pieceFell = false;
   }
-  // If the game has not started
-  else 
-  {
-    gBGTextures[ mStats->currentBG ].setAlpha( 255 * currentTicks / 3000 );
-    gBGTextures[ mStats->currentBG ].render( 0, 0 );
 
-    gPlayBGTexture.setAlpha( 255 * currentTicks / 3000 );
-    gPlayBGTexture.render( 0, 0 );
-  }
+  s.stats = *mStats;
+  s.started = mStarted;
+  s.paused = mPaused;
+  s.clearing = mClearing;
+  s.tetris = mTetris;
 }
 
 bool Play::createTetromino( TetrominoFlag type )
@@ -784,10 +532,11 @@ bool Play::createTetromino( TetrominoFlag type )
       delay = 20;
   }
 
-  mTetromino = new Tetromino( type, mGridSquares, delay );
+  mTetromino = new Tetromino( type, mGridSquares, delay, mParticles );
   if( mTetromino->getType() == TETROMINO_NULL )
   {
     delete mTetromino;
+    mTetromino = NULL;
     success = false;
   }
 
@@ -796,255 +545,29 @@ bool Play::createTetromino( TetrominoFlag type )
 
 void Play::updateNext()
 {
-  for( int i = 0; i < 8; i++ )
-  {
-    mNextSquares[ 0 ][ i ].clear();
-    mNextSquares[ 2 ][ i ].clear();
-    mNextSquares[ 4 ][ i ].clear();
-  }
-  for( int i = 0; i < 6; i++ )
-  {
-    mNextSquares[ 1 ][ i ].clear();
-    mNextSquares[ 3 ][ i ].clear();
-    mNextSquares[ 5 ][ i ].clear();
-  }
-
-  mStats->nextTetrominoes[ 0 ] = mStats->nextTetrominoes[ 1 ];
-  mStats->nextTetrominoes[ 1 ] = mStats->nextTetrominoes[ 2 ];
-  mStats->nextTetrominoes[ 2 ] = randomTetromino( mStats->nextTetrominoes[ 1 ] );
-
-  switch( mStats->nextTetrominoes[ 0 ] )
+  TetrominoFlag last = mStats->nextTetrominoes[ NEXT_QUEUE_SIZE - 1 ];
+  for( int i = 1; i < NEXT_QUEUE_SIZE; i++ )
   {
-    case TETROMINO_I:
-      mNextSquares[ 0 ][ 4 ].fill( TETROMINO_I );
-      mNextSquares[ 0 ][ 5 ].fill( TETROMINO_I );
-      mNextSquares[ 0 ][ 6 ].fill( TETROMINO_I );
-      mNextSquares[ 0 ][ 7 ].fill( TETROMINO_I );
-      break;
-
-    case TETROMINO_J:
-      mNextSquares[ 1 ][ 0 ].fill( TETROMINO_J );
-      mNextSquares[ 1 ][ 3 ].fill( TETROMINO_J );
-      mNextSquares[ 1 ][ 4 ].fill( TETROMINO_J );
-      mNextSquares[ 1 ][ 5 ].fill( TETROMINO_J );
-      break;
-
-    case TETROMINO_L:
-      mNextSquares[ 1 ][ 2 ].fill( TETROMINO_L );
-      mNextSquares[ 1 ][ 3 ].fill( TETROMINO_L );
-      mNextSquares[ 1 ][ 4 ].fill( TETROMINO_L );
-      mNextSquares[ 1 ][ 5 ].fill( TETROMINO_L );
-      break;
-
-    case TETROMINO_O:
-      mNextSquares[ 0 ][ 1 ].fill( TETROMINO_O );
-      mNextSquares[ 0 ][ 2 ].fill( TETROMINO_O );
-      mNextSquares[ 0 ][ 5 ].fill( TETROMINO_O );
-      mNextSquares[ 0 ][ 6 ].fill( TETROMINO_O );
-      break;
-
-    case TETROMINO_S:
-      mNextSquares[ 1 ][ 1 ].fill( TETROMINO_S );
-      mNextSquares[ 1 ][ 2 ].fill( TETROMINO_S );
-      mNextSquares[ 1 ][ 3 ].fill( TETROMINO_S );
-      mNextSquares[ 1 ][ 4 ].fill( TETROMINO_S );
-      break;
-
-    case TETROMINO_T:
-      mNextSquares[ 1 ][ 1 ].fill( TETROMINO_T );
-      mNextSquares[ 1 ][ 3 ].fill( TETROMINO_T );
-      mNextSquares[ 1 ][ 4 ].fill( TETROMINO_T );
-      mNextSquares[ 1 ][ 5 ].fill( TETROMINO_T );
-      break;
-
-    case TETROMINO_Z:
-      mNextSquares[ 1 ][ 0 ].fill( TETROMINO_Z );
-      mNextSquares[ 1 ][ 1 ].fill( TETROMINO_Z );
-      mNextSquares[ 1 ][ 4 ].fill( TETROMINO_Z );
-      mNextSquares[ 1 ][ 5 ].fill( TETROMINO_Z );
-      break;
-
-    default:
-      mNextState = GAME_STATE_ERROR;
-  }
-
-  switch( mStats->nextTetrominoes[ 1 ] )
-  {
-    case TETROMINO_I:
-      mNextSquares[ 2 ][ 4 ].fill( TETROMINO_I );
-      mNextSquares[ 2 ][ 5 ].fill( TETROMINO_I );
-      mNextSquares[ 2 ][ 6 ].fill( TETROMINO_I );
-      mNextSquares[ 2 ][ 7 ].fill( TETROMINO_I );
-      break;
-
-    case TETROMINO_J:
-      mNextSquares[ 3 ][ 0 ].fill( TETROMINO_J );
-      mNextSquares[ 3 ][ 3 ].fill( TETROMINO_J );
-      mNextSquares[ 3 ][ 4 ].fill( TETROMINO_J );
-      mNextSquares[ 3 ][ 5 ].fill( TETROMINO_J );
-      break;
-
-    case TETROMINO_L:
-      mNextSquares[ 3 ][ 2 ].fill( TETROMINO_L );
-      mNextSquares[ 3 ][ 3 ].fill( TETROMINO_L );
-      mNextSquares[ 3 ][ 4 ].fill( TETROMINO_L );
-      mNextSquares[ 3 ][ 5 ].fill( TETROMINO_L );
-      break;
-
-    case TETROMINO_O:
-      mNextSquares[ 2 ][ 1 ].fill( TETROMINO_O );
-      mNextSquares[ 2 ][ 2 ].fill( TETROMINO_O );
-      mNextSquares[ 2 ][ 5 ].fill( TETROMINO_O );
-      mNextSquares[ 2 ][ 6 ].fill( TETROMINO_O );
-      break;
-
-    case TETROMINO_S:
-      mNextSquares[ 3 ][ 1 ].fill( TETROMINO_S );
-      mNextSquares[ 3 ][ 2 ].fill( TETROMINO_S );
-      mNextSquares[ 3 ][ 3 ].fill( TETROMINO_S );
-      mNextSquares[ 3 ][ 4 ].fill( TETROMINO_S );
-      break;
-
-    case TETROMINO_T:
-      mNextSquares[ 3 ][ 1 ].fill( TETROMINO_T );
-      mNextSquares[ 3 ][ 3 ].fill( TETROMINO_T );
-      mNextSquares[ 3 ][ 4 ].fill( TETROMINO_T );
-      mNextSquares[ 3 ][ 5 ].fill( TETROMINO_T );
-      break;
-
-    case TETROMINO_Z:
-      mNextSquares[ 3 ][ 0 ].fill( TETROMINO_Z );
-      mNextSquares[ 3 ][ 1 ].fill( TETROMINO_Z );
-      mNextSquares[ 3 ][ 4 ].fill( TETROMINO_Z );
-      mNextSquares[ 3 ][ 5 ].fill( TETROMINO_Z );
-      break;
-
-    default:
-      mNextState = GAME_STATE_ERROR;
-  }
-
-  switch( mStats->nextTetrominoes[ 2 ] )
-  {
-    case TETROMINO_I:
-      mNextSquares[ 4 ][ 4 ].fill( TETROMINO_I );
-      mNextSquares[ 4 ][ 5 ].fill( TETROMINO_I );
-      mNextSquares[ 4 ][ 6 ].fill( TETROMINO_I );
-      mNextSquares[ 4 ][ 7 ].fill( TETROMINO_I );
-      break;
-
-    case TETROMINO_J:
-      mNextSquares[ 5 ][ 0 ].fill( TETROMINO_J );
-      mNextSquares[ 5 ][ 3 ].fill( TETROMINO_J );
-      mNextSquares[ 5 ][ 4 ].fill( TETROMINO_J );
-      mNextSquares[ 5 ][ 5 ].fill( TETROMINO_J );
-      break;
-
-    case TETROMINO_L:
-      mNextSquares[ 5 ][ 2 ].fill( TETROMINO_L );
-      mNextSquares[ 5 ][ 3 ].fill( TETROMINO_L );
-      mNextSquares[ 5 ][ 4 ].fill( TETROMINO_L );
-      mNextSquares[ 5 ][ 5 ].fill( TETROMINO_L );
-      break;
-
-    case TETROMINO_O:
-      mNextSquares[ 4 ][ 1 ].fill( TETROMINO_O );
-      mNextSquares[ 4 ][ 2 ].fill( TETROMINO_O );
-      mNextSquares[ 4 ][ 5 ].fill( TETROMINO_O );
-      mNextSquares[ 4 ][ 6 ].fill( TETROMINO_O );
-      break;
-
-    case TETROMINO_S:
-      mNextSquares[ 5 ][ 1 ].fill( TETROMINO_S );
-      mNextSquares[ 5 ][ 2 ].fill( TETROMINO_S );
-      mNextSquares[ 5 ][ 3 ].fill( TETROMINO_S );
-      mNextSquares[ 5 ][ 4 ].fill( TETROMINO_S );
-      break;
-
-    case TETROMINO_T:
-      mNextSquares[ 5 ][ 1 ].fill( TETROMINO_T );
-      mNextSquares[ 5 ][ 3 ].fill( TETROMINO_T );
-      mNextSquares[ 5 ][ 4 ].fill( TETROMINO_T );
-      mNextSquares[ 5 ][ 5 ].fill( TETROMINO_T );
-      break;
-
-    case TETROMINO_Z:
-      mNextSquares[ 5 ][ 0 ].fill( TETROMINO_Z );
-      mNextSquares[ 5 ][ 1 ].fill( TETROMINO_Z );
-      mNextSquares[ 5 ][ 4 ].fill( TETROMINO_Z );
-      mNextSquares[ 5 ][ 5 ].fill( TETROMINO_Z );
-      break;
-
-    default:
-      mNextState = GAME_STATE_ERROR;
+    mStats->nextTetrominoes[ i - 1 ] = mStats->nextTetrominoes[ i ];
   }
+  mStats->nextTetrominoes[ NEXT_QUEUE_SIZE - 1 ] = randomTetromino( last );
 }
 
-void Play::updateHold()
+// Keys the falling Tetromino and the hold respond to
+bool Play::isGameKey( SDL_Keycode key )
 {
-  for( int i = 0; i < 8; i++ )
-  {
-    mHoldSquares[ 0 ][ i ].clear();
-  }
-  for( int i = 0; i < 6; i++ )
-  {
-    mHoldSquares[ 1 ][ i ].clear();
-  }
-
-  switch( mStats->holdTetromino )
+  switch( key )
   {
-    case TETROMINO_NULL:
-      break;
-
-    case TETROMINO_I:
-      mHoldSquares[ 0 ][ 4 ].fill( TETROMINO_I );
-      mHoldSquares[ 0 ][ 5 ].fill( TETROMINO_I );
-      mHoldSquares[ 0 ][ 6 ].fill( TETROMINO_I );
-      mHoldSquares[ 0 ][ 7 ].fill( TETROMINO_I );
-      break;
-
-    case TETROMINO_J:
-      mHoldSquares[ 1 ][ 0 ].fill( TETROMINO_J );
-      mHoldSquares[ 1 ][ 3 ].fill( TETROMINO_J );
-      mHoldSquares[ 1 ][ 4 ].fill( TETROMINO_J );
-      mHoldSquares[ 1 ][ 5 ].fill( TETROMINO_J );
-      break;
-
-    case TETROMINO_L:
-      mHoldSquares[ 1 ][ 2 ].fill( TETROMINO_L );
-      mHoldSquares[ 1 ][ 3 ].fill( TETROMINO_L );
-      mHoldSquares[ 1 ][ 4 ].fill( TETROMINO_L );
-      mHoldSquares[ 1 ][ 5 ].fill( TETROMINO_L );
-      break;
-
-    case TETROMINO_O:
-      mHoldSquares[ 0 ][ 1 ].fill( TETROMINO_O );
-      mHoldSquares[ 0 ][ 2 ].fill( TETROMINO_O );
-      mHoldSquares[ 0 ][ 5 ].fill( TETROMINO_O );
-      mHoldSquares[ 0 ][ 6 ].fill( TETROMINO_O );
-      break;
-
-    case TETROMINO_S:
-      mHoldSquares[ 1 ][ 1 ].fill( TETROMINO_S );
-      mHoldSquares[ 1 ][ 2 ].fill( TETROMINO_S );
-      mHoldSquares[ 1 ][ 3 ].fill( TETROMINO_S );
-      mHoldSquares[ 1 ][ 4 ].fill( TETROMINO_S );
-      break;
-
-    case TETROMINO_T:
-      mHoldSquares[ 1 ][ 1 ].fill( TETROMINO_T );
-      mHoldSquares[ 1 ][ 3 ].fill( TETROMINO_T );
-      mHoldSquares[ 1 ][ 4 ].fill( TETROMINO_T );
-      mHoldSquares[ 1 ][ 5 ].fill( TETROMINO_T );
-      break;
-
-    case TETROMINO_Z:
-      mHoldSquares[ 1 ][ 0 ].fill( TETROMINO_Z );
-      mHoldSquares[ 1 ][ 1 ].fill( TETROMINO_Z );
-      mHoldSquares[ 1 ][ 4 ].fill( TETROMINO_Z );
-      mHoldSquares[ 1 ][ 5 ].fill( TETROMINO_Z );
-      break;
-
+    case SDLK_LEFT:
+    case SDLK_RIGHT:
+    case SDLK_UP:
+    case SDLK_DOWN:
+    case SDLK_SPACE:
+    case SDLK_x:
+    case SDLK_z:
+    case SDLK_c:
+      return true;
     default:
-      mNextState = GAME_STATE_ERROR;
+      return false;
   }
 }
@@ -7,33 +7,32 @@
 #include "../Square/Square.h"
 #include "../Tetromino/Tetromino.h"
 #include "../GameState/GameState.h"
+#include "../ParticleSystem/ParticleSystem.h"
 
 class Play : public GameState
 {
   public:
-  Play( Stats* stats, Square* gridSquares, Square** nextSquares, Square** holdSquares, SDL_Rect* statAreas );
+  Play( Stats* stats, Square* gridSquares, ParticleSystem* particles );
   ~Play();
 
+  void enter();
+  void exit();
   void handleEvent( SDL_Event& e );
   void logic();
-  void render();
+  void snapshot( FrameSnapshot& s );
 
   private:
   bool createTetromino( TetrominoFlag type );
   void updateNext();
-  void updateHold();
+  bool isGameKey( SDL_Keycode key );
 
   Stats* mStats;
   Square* mGridSquares;
-  Square** mNextSquares;
-  Square** mHoldSquares;
   Tetromino* mTetromino;
-  SDL_Point mStatCenters[ 3 ];
-  SDL_Point mStatPositions[ 3 ];
+  ParticleSystem* mParticles;
   bool mStarted;
   bool mPaused;
   bool mHolding;
-  bool mStatsChanged;
   bool mClearing;
   bool mTetris;
 };
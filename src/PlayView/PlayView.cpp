@@ -0,0 +1,334 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <string>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../LTexture/LTexture.h"
+#include "../textures/textures.h"
+#include "../Square/Square.h"
+#include "../Timeline/Timeline.h"
+#include "../View/View.h"
+#include "PlayView.h"
+
+// Board fading in before the start, and the shade, hands, fading rows and tetris
+// flash of a line clear
+static const Keyframe FADE_IN_KEYS[] = { { 0, 0 }, { 3000, 255 } };
+static const Keyframe SHADE_KEYS[] = { { 0, 0 }, { 500, 255 } };
+static const Keyframe HAND_FRAME_KEYS[] = { { 0, 0 }, { 50, 1 }, { 100, 2 }, { 150, 3 }, { 200, 4 } };
+static const Keyframe ROW_ALPHA_KEYS[] = { { 0, 255 }, { 500, 0 } };
+static const Keyframe FLASH_KEYS[] = { { 0, 0 }, { 100, 255 } };
+
+PlayView::PlayView( Square* gridSquares, SDL_Rect* nextAreas, SDL_Rect& holdArea, SDL_Rect* statAreas )
+{
+  mGridSquares = gridSquares;
+  for( int i = 0; i < NEXT_QUEUE_SIZE; i++ )
+  {
+    mNextAreas[ i ] = nextAreas[ i ];
+  }
+  mHoldArea = holdArea;
+
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+  for( int i = 0; i < PARTICLE_CAPACITY; i++ )
+  {
+    mIndices[ i * 6 ] = i * 4;
+    mIndices[ i * 6 + 1 ] = i * 4 + 1;
+    mIndices[ i * 6 + 2 ] = i * 4 + 2;
+    mIndices[ i * 6 + 3 ] = i * 4 + 2;
+    mIndices[ i * 6 + 4 ] = i * 4 + 3;
+    mIndices[ i * 6 + 5 ] = i * 4;
+  }
+#endif
+
+  for( int i = 0; i < 3; i++ )
+  {
+    mStatCenters[ i ].x = statAreas[ i ].x + ( statAreas[ i ].w / 2 );
+    mStatCenters[ i ].y = statAreas[ i ].y + ( statAreas[ i ].h / 2 );
+    mStatPositions[ i ] = mStatCenters[ i ];
+  }
+
+  mFadeInTrack = mTimeline.addTrack( FADE_IN_KEYS, 2 );
+  mShadeTrack = mTimeline.addTrack( SHADE_KEYS, 2 );
+  mHandFrameTrack = mTimeline.addTrack( HAND_FRAME_KEYS, 5, true );
+  mRowAlphaTrack = mTimeline.addTrack( ROW_ALPHA_KEYS, 2 );
+  mFlashTrack = mTimeline.addTrack( FLASH_KEYS, 2, false, 100 );
+  mPauseTrack = addPulseTrack( mPauseTimeline );
+
+  mStarted = false;
+  mClearing = false;
+  mPaused = false;
+}
+
+PlayView::~PlayView()
+{
+  mGridSquares = NULL;
+}
+
+void PlayView::enter( FrameSnapshot& s )
+{
+  // Force the stats to be rebuilt on the first frame
+  mScore = -1;
+  mLines = -1;
+  mLevel = -1;
+
+  for( int i = 0; i < TOTAL_BG; i++ )
+  {
+    gBGTextures[ i ].setAlpha( 255 );
+  }
+
+  mTimeline.reset();
+  mPauseTimeline.reset();
+}
+
+void PlayView::render( FrameSnapshot& s, float interpolation )
+{
+  int currentTicks = getRenderTicks( s, interpolation );
+
+  // Line clears last half a second
+  if( s.clearing && currentTicks > 500 )
+  {
+    currentTicks = 500;
+  }
+
+  if( s.started != mStarted || s.clearing != mClearing )
+  {
+    mStarted = s.started;
+    mClearing = s.clearing;
+    mTimeline.reset();
+  }
+
+  mTimeline.evaluate( currentTicks );
+
+  for( int i = 0; i < TOTAL_SQUARES; i++ )
+  {
+    mGridSquares[ i ].setSprite( s.squareSprites[ i ] );
+    mGridSquares[ i ].setAlpha( s.squareAlphas[ i ] );
+  }
+
+  // If the game has started
+  if( s.started )
+  {
+    gRenderQueue.setLayer( RENDER_LAYER_BACKGROUND );
+    gBGTextures[ s.stats.currentBG ].render( 0, 0 );
+
+    // If lines are being cleared
+    if( s.clearing )
+    {
+      if( mTimeline.hasChanged( mShadeTrack ) )
+      {
+	gBlackTexture.setAlpha( mTimeline.getValue( mShadeTrack ) );
+      }
+
+      gRenderQueue.setLayer( RENDER_LAYER_SHADE );
+      gBlackTexture.render( 0, 0 );
+
+      int frame = mTimeline.getValue( mHandFrameTrack );
+
+      gRenderQueue.setLayer( RENDER_LAYER_DECORATION );
+      gHandWhiteTexture.render( 0, 0, &gHandClips[ frame ] );
+      gHandWhiteTexture.render( 0, 275, &gHandClips[ frame ] );
+
+      if( currentTicks < 500 )
+      {
+	for( int i = 0; i < TOTAL_SQUARES; i += TOTAL_COLS )
+	{
+	  bool rowFilled = true;
+
+	  for( int j = i; j < i + TOTAL_COLS; j++ )
+	  {
+	    if( s.squareStates[ j ] != SQUARE_STATE_STILL )
+	    {
+	      rowFilled = false;
+	    }
+	  }
+
+	  if( rowFilled )
+	  {
+	    for( int j = i; j < i + TOTAL_COLS; j++ )
+	    {
+	      mGridSquares[ j ].setAlpha( mTimeline.getValue( mRowAlphaTrack ) );
+	    }
+	  }
+	}
+      }
+    }
+      
+    gRenderQueue.setLayer( RENDER_LAYER_FRAME );
+    gPlayBGTexture.render( 0, 0 );
+
+    // If player got a tetris
+    if( s.tetris )
+    {
+      if( mTimeline.hasChanged( mFlashTrack ) )
+      {
+	gTetrisTexture.setAlpha( mTimeline.getValue( mFlashTrack ) );
+      }
+
+      gRenderQueue.setLayer( RENDER_LAYER_FLASH );
+      gTetrisTexture.render( 0, 0 );
+    }
+
+    SDL_Color textColor = { 0, 0, 0 };
+
+    // If stats need to be updated
+    if( s.stats.score != mScore || s.stats.lines != mLines || s.stats.level != mLevel )
+    {
+      mScore = s.stats.score;
+      mLines = s.stats.lines;
+      mLevel = s.stats.level;
+
+      std::string score = std::to_string( s.stats.score );
+      gScoreTextTexture.loadFromRenderedText( score.c_str(), textColor );
+      mStatPositions[ 0 ].x = mStatCenters[ 0 ].x - ( gScoreTextTexture.getWidth() / 2 );
+      mStatPositions[ 0 ].y = mStatCenters[ 0 ].y - ( gScoreTextTexture.getHeight() / 2 );
+
+      std::string lines = std::to_string( s.stats.lines );
+      gLinesTextTexture.loadFromRenderedText( lines.c_str(), textColor );
+      mStatPositions[ 1 ].x = mStatCenters[ 1 ].x - ( gLinesTextTexture.getWidth() / 2 );
+      mStatPositions[ 1 ].y = mStatCenters[ 1 ].y - ( gLinesTextTexture.getHeight() / 2 );
+
+      std::string level = std::to_string( s.stats.level );
+      gLevelTextTexture.loadFromRenderedText( level.c_str(), textColor );
+      mStatPositions[ 2 ].x = mStatCenters[ 2 ].x - ( gLevelTextTexture.getWidth() / 2 );
+      mStatPositions[ 2 ].y = mStatCenters[ 2 ].y - ( gLevelTextTexture.getHeight() / 2 );
+
+    }
+
+    gRenderQueue.setLayer( RENDER_LAYER_TEXT );
+    gScoreTextTexture.render( mStatPositions[ 0 ].x, mStatPositions[ 0 ].y );
+    gLinesTextTexture.render( mStatPositions[ 1 ].x, mStatPositions[ 1 ].y );
+    gLevelTextTexture.render( mStatPositions[ 2 ].x, mStatPositions[ 2 ].y );
+
+    gRenderQueue.setLayer( RENDER_LAYER_SQUARES );
+    for( int i = 0; i < NEXT_QUEUE_SIZE; i++ )
+    {
+      gPreviewCache.render( s.stats.nextTetrominoes[ i ], mNextAreas[ i ] );
+    }
+    gPreviewCache.render( s.stats.holdTetromino, mHoldArea );
+
+    // Slide the Tetromino between rows while it falls
+    int piece[ 4 ] = { -1, -1, -1, -1 };
+    int fallOffset = 0;
+
+    if( s.pieceFell && !s.paused )
+    {
+      for( int i = 0; i < 4; i++ )
+      {
+	piece[ i ] = s.piecePositions[ i ];
+      }
+
+      fallOffset = (int)( ( interpolation - 1.0f ) * Square::SQUARE_HEIGHT );
+    }
+
+    for( int i = ( 2 * TOTAL_COLS ); i < TOTAL_SQUARES; i++ )
+    {
+      if( s.squareStates[ i ] != SQUARE_STATE_BLANK &&
+	  i != piece[ 0 ] && i != piece[ 1 ] && i != piece[ 2 ] && i != piece[ 3 ] )
+      {
+	mGridSquares[ i ].render();
+      }
+    }
+
+    for( int i = 0; i < 4; i++ )
+    {
+      if( piece[ i ] >= ( 3 * TOTAL_COLS ) )
+      {
+	mGridSquares[ piece[ i ] ].render( 0, fallOffset );
+      }
+      else if( piece[ i ] >= ( 2 * TOTAL_COLS ) )
+      {
+	mGridSquares[ piece[ i ] ].render();
+      }
+    }
+
+    renderParticles( s.particles, s.paused ? 0.0f : interpolation );
+
+    // If the game is paused
+    if( s.paused )
+    {
+      if( !mPaused )
+      {
+	mPauseTimeline.reset();
+      }
+
+      mPauseTimeline.evaluate( s.pauseTicks );
+      if( mPauseTimeline.hasChanged( mPauseTrack ) )
+      {
+	gPausedTexture.setAlpha( mPauseTimeline.getValue( mPauseTrack ) );
+      }
+
+      gRenderQueue.setLayer( RENDER_LAYER_OVERLAY );
+      gPausedTexture.render( 0, 0 );
+    }
+    mPaused = s.paused;
+  }
+  // If the game has not started
+  else 
+  {
+    if( mTimeline.hasChanged( mFadeInTrack ) )
+    {
+      gBGTextures[ s.stats.currentBG ].setAlpha( mTimeline.getValue( mFadeInTrack ) );
+      gPlayBGTexture.setAlpha( mTimeline.getValue( mFadeInTrack ) );
+    }
+
+    gRenderQueue.setLayer( RENDER_LAYER_BACKGROUND );
+    gBGTextures[ s.stats.currentBG ].render( 0, 0 );
+
+    gRenderQueue.setLayer( RENDER_LAYER_FRAME );
+    gPlayBGTexture.render( 0, 0 );
+  }
+}
+
+// Draw particles as small pieces of the Square sprites, moved on by the interpolation
+void PlayView::renderParticles( ParticleBuffer& p, float interpolation )
+{
+  if( p.count == 0 )
+  {
+    return;
+  }
+
+  SDL_Point origin = mGridSquares[ 0 ].getPosition();
+  float t = interpolation / LOGIC_TICKS_PER_SECOND;
+
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+  for( int i = 0; i < p.count; i++ )
+  {
+    float x = origin.x + ( p.x[ i ] + p.vx[ i ] * t ) * Square::SQUARE_WIDTH - p.size[ i ] / 2;
+    float y = origin.y + ( p.y[ i ] + p.vy[ i ] * t ) * Square::SQUARE_HEIGHT - p.size[ i ] / 2;
+    SDL_Rect& clip = gSquareSpriteClips[ p.sprite[ i ] ];
+    float u = clip.x + ( clip.w - p.size[ i ] ) / 2;
+    float v = clip.y + ( clip.h - p.size[ i ] ) / 2;
+    SDL_Color color = { 255, 255, 255, p.alpha[ i ] };
+
+    SDL_Vertex* corners = &mVertices[ i * 4 ];
+    for( int c = 0; c < 4; c++ )
+    {
+      float dx = ( c == 1 || c == 2 ) ? p.size[ i ] : 0;
+      float dy = ( c >= 2 ) ? p.size[ i ] : 0;
+      corners[ c ].position.x = x + dx;
+      corners[ c ].position.y = y + dy;
+      corners[ c ].tex_coord.x = u + dx;
+      corners[ c ].tex_coord.y = v + dy;
+      corners[ c ].color = color;
+    }
+  }
+
+  gSquareSpriteTexture.renderGeometry( mVertices, p.count * 4, mIndices, p.count * 6 );
+#else
+  // Without geometry support each particle is its own copy
+  gRenderQueue.setLayer( RENDER_LAYER_PARTICLES );
+  for( int i = 0; i < p.count; i++ )
+  {
+    int x = origin.x + (int)( ( p.x[ i ] + p.vx[ i ] * t ) * Square::SQUARE_WIDTH ) - p.size[ i ] / 2;
+    int y = origin.y + (int)( ( p.y[ i ] + p.vy[ i ] * t ) * Square::SQUARE_HEIGHT ) - p.size[ i ] / 2;
+    SDL_Rect clip = gSquareSpriteClips[ p.sprite[ i ] ];
+    clip.x += ( clip.w - p.size[ i ] ) / 2;
+    clip.y += ( clip.h - p.size[ i ] ) / 2;
+    clip.w = p.size[ i ];
+    clip.h = p.size[ i ];
+
+    gSquareSpriteTexture.setAlpha( p.alpha[ i ] );
+    gSquareSpriteTexture.render( x, y, &clip );
+  }
+#endif
+}
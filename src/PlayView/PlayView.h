@@ -0,0 +1,53 @@
+#ifndef PLAYVIEW_H
+#define PLAYVIEW_H
+
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../Square/Square.h"
+#include "../Timeline/Timeline.h"
+#include "../View/View.h"
+
+class PlayView : public View
+{
+  public:
+  PlayView( Square* gridSquares, SDL_Rect* nextAreas, SDL_Rect& holdArea, SDL_Rect* statAreas );
+  ~PlayView();
+
+  void enter( FrameSnapshot& s );
+  void render( FrameSnapshot& s, float interpolation );
+
+  private:
+  void renderParticles( ParticleBuffer& p, float interpolation );
+
+  Square* mGridSquares;
+  SDL_Rect mNextAreas[ NEXT_QUEUE_SIZE ];
+  SDL_Rect mHoldArea;
+  SDL_Point mStatCenters[ 3 ];
+  SDL_Point mStatPositions[ 3 ];
+  int mScore;
+  int mLines;
+  int mLevel;
+
+  // Play's timer restarts with each phase, which resets the timelines
+  Timeline mTimeline;
+  Timeline mPauseTimeline;
+  int mFadeInTrack;
+  int mShadeTrack;
+  int mHandFrameTrack;
+  int mRowAlphaTrack;
+  int mFlashTrack;
+  int mPauseTrack;
+  bool mStarted;
+  bool mClearing;
+  bool mPaused;
+
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+  // Four corners and two triangles per particle
+  SDL_Vertex mVertices[ PARTICLE_CAPACITY * 4 ];
+  int mIndices[ PARTICLE_CAPACITY * 6 ];
+#endif
+};
+
+#endif
@@ -0,0 +1,76 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../LTexture/LTexture.h"
+#include "../textures/textures.h"
+#include "../Square/Square.h"
+#include "PreviewCache.h"
+
+// Draw every Tetromino preview into its own target texture
+bool PreviewCache::build()
+{
+  bool success = true;
+
+  gRenderQueue.setLayer( RENDER_LAYER_SQUARES );
+  gSquareSpriteTexture.setAlpha( 255 );
+
+  for( int type = 0; type < TETROMINO_NULL; type++ )
+  {
+    const PreviewShape& shape = PREVIEW_SHAPES[ type ];
+
+    // Sized at the output scale so the sprite sheet is copied texel for texel
+    if( !mSprites[ type ].createBlank( shape.width * Square::SQUARE_WIDTH, 2 * Square::SQUARE_HEIGHT, SDL_TEXTUREACCESS_TARGET, LTexture::getScale() ) )
+    {
+      success = false;
+      continue;
+    }
+    mSprites[ type ].setBlendMode( SDL_BLENDMODE_BLEND );
+
+    mSprites[ type ].setAsRenderTarget();
+    SDL_SetRenderDrawColor( gRenderer, 0x00, 0x00, 0x00, 0x00 );
+    SDL_RenderClear( gRenderer );
+
+    for( int i = 0; i < 4; i++ )
+    {
+      int x = ( shape.cells[ i ] % shape.width ) * Square::SQUARE_WIDTH;
+      int y = ( shape.cells[ i ] / shape.width ) * Square::SQUARE_HEIGHT;
+      SDL_Rect cell = { x, y, Square::SQUARE_WIDTH, Square::SQUARE_HEIGHT };
+      SDL_Rect quad = mSprites[ type ].scaleRect( cell );
+      gSquareSpriteTexture.renderScaled( quad, &gSquareSpriteClips[ SQUARE_SPRITE_I + type ] );
+    }
+
+    // Draw into this target before switching to the next
+    gRenderQueue.submit();
+  }
+
+  SDL_SetRenderTarget( gRenderer, NULL );
+  SDL_SetRenderDrawColor( gRenderer, 0xFF, 0xFF, 0xFF, 0xFF );
+
+  return success;
+}
+
+void PreviewCache::free()
+{
+  for( int i = 0; i < TETROMINO_NULL; i++ )
+  {
+    mSprites[ i ].free();
+  }
+}
+
+// Queue the preview of a Tetromino centred in an area
+void PreviewCache::render( TetrominoFlag type, SDL_Rect& area, Uint8 alpha )
+{
+  if( type < 0 || type >= TETROMINO_NULL )
+  {
+    return;
+  }
+
+  const PreviewShape& shape = PREVIEW_SHAPES[ type ];
+  int x = area.x + ( area.w / 2 ) - ( shape.width * Square::SQUARE_WIDTH / 2 );
+  int y = area.y + ( area.h / 2 ) - ( Square::SQUARE_HEIGHT * 2 );
+
+  mSprites[ type ].setAlpha( alpha );
+  mSprites[ type ].render( x, y );
+}
@@ -0,0 +1,21 @@
+#ifndef PREVIEWCACHE_H
+#define PREVIEWCACHE_H
+
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+#include "../LTexture/LTexture.h"
+
+// Each Tetromino pre-rendered once so a preview costs a single copy
+class PreviewCache
+{
+  public:
+  bool build();
+  void free();
+  void render( TetrominoFlag type, SDL_Rect& area, Uint8 alpha = 255 );
+
+  private:
+  LTexture mSprites[ TETROMINO_NULL ];
+};
+
+#endif
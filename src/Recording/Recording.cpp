@@ -0,0 +1,123 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "../globals/globals.h"
+#include "../IOWorker/IOWorker.h"
+#include "Recording.h"
+
+// Initialize member variables
+Recording::Recording()
+{
+  mSeed = 0;
+  mSteps = 0;
+  mActive = false;
+}
+
+// Forget any previous game and start recording a new one
+void Recording::begin( Uint32 seed )
+{
+  mEvents.clear();
+  mSeed = seed;
+  mSteps = 0;
+  mActive = true;
+}
+
+// Keep an event handled on the given logic step
+void Recording::add( Uint32 step, SDL_Event& e )
+{
+  if( !mActive )
+  {
+    return;
+  }
+
+  RecordedEvent r;
+  r.step = step;
+  r.event = e;
+  mEvents.push_back( r );
+}
+
+// Stop recording after the given number of logic steps
+void Recording::end( Uint32 steps )
+{
+  mSteps = steps;
+  mActive = false;
+}
+
+// Queue the header and events to be written to a file in the background
+bool Recording::save( std::string path )
+{
+  Uint32 header[ 4 ] = { MAGIC, mSeed, mSteps, (Uint32)mEvents.size() };
+
+  return gIOWorker.replace( path, header, sizeof( header ), mEvents.data(), mEvents.size() * sizeof( RecordedEvent ) );
+}
+
+// Read a file written by save
+bool Recording::load( std::string path )
+{
+  SDL_RWops* file = SDL_RWFromFile( path.c_str(), "rb" );
+  if( file == NULL )
+  {
+    printf( "Could not open recording %s! SDL Error: %s\n", path.c_str(), SDL_GetError() );
+    return false;
+  }
+
+  bool success = true;
+  Uint32 header[ 4 ];
+
+  if( SDL_RWread( file, header, sizeof( header ), 1 ) != 1 || header[ 0 ] != MAGIC )
+  {
+    printf( "%s is not a recording!\n", path.c_str() );
+    success = false;
+  }
+  else if( SDL_RWsize( file ) < (Sint64)sizeof( header ) + (Sint64)header[ 3 ] * (Sint64)sizeof( RecordedEvent ) )
+  {
+    // A count the file cannot hold means it is damaged, not a huge game
+    printf( "Recording %s is damaged!\n", path.c_str() );
+    success = false;
+  }
+  else
+  {
+    mSeed = header[ 1 ];
+    mSteps = header[ 2 ];
+    mEvents.resize( header[ 3 ] );
+
+    if( !mEvents.empty() && SDL_RWread( file, &mEvents[ 0 ], sizeof( RecordedEvent ), mEvents.size() ) != mEvents.size() )
+    {
+      printf( "Recording %s is truncated!\n", path.c_str() );
+      success = false;
+    }
+  }
+
+  SDL_RWclose( file );
+  mActive = false;
+
+  return success;
+}
+
+bool Recording::isActive()
+{
+  return mActive;
+}
+
+Uint32 Recording::getSeed()
+{
+  return mSeed;
+}
+
+// Logic steps from the start of the game until it ended
+Uint32 Recording::getSteps()
+{
+  return mSteps;
+}
+
+int Recording::getEventCount()
+{
+  return mEvents.size();
+}
+
+RecordedEvent& Recording::getEvent( int index )
+{
+  return mEvents[ index ];
+}
@@ -0,0 +1,37 @@
+#ifndef RECORDING_H
+#define RECORDING_H
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+
+#include "../globals/globals.h"
+
+// A game stored as its random seed and the input seen on each logic step
+class Recording
+{
+  public:
+  Recording();
+
+  void begin( Uint32 seed );
+  void add( Uint32 step, SDL_Event& e );
+  void end( Uint32 steps );
+  bool save( std::string path );
+  bool load( std::string path );
+
+  bool isActive();
+  Uint32 getSeed();
+  Uint32 getSteps();
+  int getEventCount();
+  RecordedEvent& getEvent( int index );
+
+  private:
+  static const Uint32 MAGIC = 0x31525054; // "TPR1"
+
+  std::vector<RecordedEvent> mEvents;
+  Uint32 mSeed;
+  Uint32 mSteps;
+  bool mActive;
+};
+
+#endif
@@ -0,0 +1,429 @@
+#include <SDL2/SDL.h>
+#include <algorithm>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "RenderQueue.h"
+
+// FNV-1a, used to notice which tiles drew something different from last frame
+static const Uint32 HASH_BASIS = 2166136261u;
+static const Uint32 HASH_PRIME = 16777619u;
+
+static Uint32 hashBytes( Uint32 hash, const void* data, int size )
+{
+  const Uint8* bytes = (const Uint8*)data;
+  for( int i = 0; i < size; i++ )
+  {
+    hash = ( hash ^ bytes[ i ] ) * HASH_PRIME;
+  }
+
+  return hash;
+}
+
+// Order by layer, then group copies of the same texture, keeping record order otherwise
+static bool commandLess( const RenderCommand* a, const RenderCommand* b )
+{
+  if( a->layer != b->layer )
+  {
+    return a->layer < b->layer;
+  }
+  if( a->texture != b->texture )
+  {
+    return a->texture < b->texture;
+  }
+  return a->order < b->order;
+}
+
+// Initialize member variables
+RenderQueue::RenderQueue()
+{
+  mCount = 0;
+  mLayer = RENDER_LAYER_BACKGROUND;
+  mBackend = RENDER_BACKEND_SDL;
+  mFrameCommands = 0;
+  mFrameBatches = 0;
+  mCommandCount = 0;
+  mBatchCount = 0;
+
+  mDirtyTracking = false;
+  mHasPrevious = false;
+  mFullRedraw = false;
+  mDirtyCount = -1;
+  for( int i = 0; i < DIRTY_TILES; i++ )
+  {
+    mFrameHashes[ i ] = HASH_BASIS;
+    mTileHashes[ i ] = HASH_BASIS;
+  }
+}
+
+// Choose where commands are submitted
+void RenderQueue::setBackend( RenderBackend backend )
+{
+  mBackend = backend;
+}
+
+RenderBackend RenderQueue::getBackend()
+{
+  return mBackend;
+}
+
+// Layer given to every command recorded until the next change
+void RenderQueue::setLayer( RenderLayer layer )
+{
+  mLayer = layer;
+}
+
+// Record one texture copy with the alpha it should be drawn at, version
+// changing whenever the texture's contents do
+void RenderQueue::push( SDL_Texture* texture, SDL_Rect* clip, SDL_Rect& quad, Uint8 alpha, Uint32 version )
+{
+  if( texture == NULL )
+  {
+    return;
+  }
+
+  bool tracking = isTrackingScreen();
+
+  // Anything already recorded is drawn before this command either way
+  if( mCount == RENDER_QUEUE_SIZE )
+  {
+    if( tracking )
+    {
+      beginFullRedraw();
+    }
+    flush();
+  }
+
+  RenderCommand& c = mCommands[ mCount ];
+  c.texture = texture;
+  c.clipped = clip != NULL;
+  if( c.clipped )
+  {
+    c.clip = *clip;
+  }
+  c.quad = quad;
+  c.order = mCount;
+  c.alpha = alpha;
+  c.layer = mLayer;
+
+  mSorted[ mCount ] = &c;
+  mCount++;
+
+  if( tracking )
+  {
+    hashCommand( c, version );
+  }
+}
+
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+// Draw a batch of triangles in one call, after everything already recorded
+void RenderQueue::pushGeometry( SDL_Texture* texture, SDL_Vertex* vertices, int numVertices, int* indices, int numIndices )
+{
+  // Triangles are not tracked by tile, so the frame is drawn in full
+  if( isTrackingScreen() )
+  {
+    beginFullRedraw();
+  }
+
+  flush();
+
+  if( mBackend == RENDER_BACKEND_SDL )
+  {
+    SDL_SetTextureAlphaMod( texture, 255 );
+    SDL_RenderGeometry( gRenderer, texture, vertices, numVertices, indices, numIndices );
+  }
+
+  mFrameCommands++;
+  mFrameBatches++;
+}
+#endif
+
+// Submit the frame and start recording the next one
+void RenderQueue::submit()
+{
+  if( isTrackingScreen() )
+  {
+    findDirtyRects();
+
+    if( mDirtyCount < 0 )
+    {
+      beginFullRedraw();
+      flush();
+    }
+    else
+    {
+      drawDirtyRects();
+    }
+
+    mFullRedraw = false;
+  }
+  else
+  {
+    flush();
+  }
+
+  mCommandCount = mFrameCommands;
+  mBatchCount = mFrameBatches;
+  mFrameCommands = 0;
+  mFrameBatches = 0;
+  mLayer = RENDER_LAYER_BACKGROUND;
+}
+
+// Sort and send recorded commands to the backend
+void RenderQueue::flush()
+{
+  std::sort( mSorted, mSorted + mCount, commandLess );
+
+  SDL_Texture* lastTexture = NULL;
+  int lastAlpha = -1;
+  for( int i = 0; i < mCount; i++ )
+  {
+    RenderCommand* c = mSorted[ i ];
+
+    if( c->texture != lastTexture )
+    {
+      lastTexture = c->texture;
+      lastAlpha = -1;
+      mFrameBatches++;
+    }
+
+    if( mBackend == RENDER_BACKEND_SDL )
+    {
+      // Only touch the texture's alpha when it differs within a batch
+      if( c->alpha != lastAlpha )
+      {
+	lastAlpha = c->alpha;
+	SDL_SetTextureAlphaMod( c->texture, c->alpha );
+      }
+      SDL_RenderCopy( gRenderer, c->texture, c->clipped ? &c->clip : NULL, &c->quad );
+    }
+  }
+
+  mFrameCommands += mCount;
+  mCount = 0;
+}
+
+// Redraw only screen regions whose commands changed since the last frame
+void RenderQueue::setDirtyTracking( bool tracking )
+{
+  mDirtyTracking = tracking;
+  invalidate();
+}
+
+bool RenderQueue::getDirtyTracking()
+{
+  return mDirtyTracking;
+}
+
+// Forget the last frame so the next one is drawn in full
+void RenderQueue::invalidate()
+{
+  mHasPrevious = false;
+}
+
+// Show the submitted frame, updating only its dirty rects when tracking them
+void RenderQueue::present()
+{
+  if( !mDirtyTracking || mDirtyCount < 0 )
+  {
+    SDL_RenderPresent( gRenderer );
+    return;
+  }
+
+  if( mDirtyCount == 0 )
+  {
+    return;
+  }
+
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+  // The software renderer draws straight into the window surface
+  SDL_RenderFlush( gRenderer );
+
+  for( int i = 0; i < mDirtyCount; i++ )
+  {
+    SDL_Rect& r = mDirtyRects[ i ];
+    int x1, y1, x2, y2;
+    SDL_RenderLogicalToWindow( gRenderer, r.x, r.y, &x1, &y1 );
+    SDL_RenderLogicalToWindow( gRenderer, r.x + r.w, r.y + r.h, &x2, &y2 );
+    r.x = x1;
+    r.y = y1;
+    r.w = x2 - x1;
+    r.h = y2 - y1;
+  }
+
+  SDL_UpdateWindowSurfaceRects( gWindow, mDirtyRects, mDirtyCount );
+#else
+  SDL_RenderPresent( gRenderer );
+#endif
+}
+
+// Commands in the last submitted frame
+int RenderQueue::getCommandCount()
+{
+  return mCommandCount;
+}
+
+// Texture changes in the last submitted frame
+int RenderQueue::getBatchCount()
+{
+  return mBatchCount;
+}
+
+// Rects redrawn in the last submitted frame, or -1 if it was drawn in full
+int RenderQueue::getDirtyRectCount()
+{
+  return mDirtyCount;
+}
+
+// Dirty rects only apply to frames drawn to the window
+bool RenderQueue::isTrackingScreen()
+{
+  return mDirtyTracking && mBackend == RENDER_BACKEND_SDL && SDL_GetRenderTarget( gRenderer ) == NULL;
+}
+
+// Clear the whole screen once before drawing a frame in full
+void RenderQueue::beginFullRedraw()
+{
+  if( !mFullRedraw )
+  {
+    mFullRedraw = true;
+    SDL_SetRenderDrawColor( gRenderer, 0xFF, 0xFF, 0xFF, 0xFF );
+    SDL_RenderClear( gRenderer );
+  }
+}
+
+// Mix a command into the hash of every tile it covers
+void RenderQueue::hashCommand( RenderCommand& c, Uint32 version )
+{
+  Uint32 hash = hashBytes( HASH_BASIS, &c.texture, sizeof( c.texture ) );
+  hash = hashBytes( hash, &version, sizeof( version ) );
+  hash = hashBytes( hash, &c.quad, sizeof( c.quad ) );
+  hash = hashBytes( hash, &c.alpha, sizeof( c.alpha ) );
+  hash = hashBytes( hash, &c.layer, sizeof( c.layer ) );
+  if( c.clipped )
+  {
+    hash = hashBytes( hash, &c.clip, sizeof( c.clip ) );
+  }
+
+  int left = std::max( c.quad.x / DIRTY_TILE_SIZE, 0 );
+  int top = std::max( c.quad.y / DIRTY_TILE_SIZE, 0 );
+  int right = std::min( ( c.quad.x + c.quad.w - 1 ) / DIRTY_TILE_SIZE, DIRTY_TILE_COLS - 1 );
+  int bottom = std::min( ( c.quad.y + c.quad.h - 1 ) / DIRTY_TILE_SIZE, DIRTY_TILE_ROWS - 1 );
+
+  for( int row = top; row <= bottom; row++ )
+  {
+    for( int col = left; col <= right; col++ )
+    {
+      Uint32& tile = mFrameHashes[ ( row * DIRTY_TILE_COLS ) + col ];
+      tile = ( tile ^ hash ) * HASH_PRIME;
+    }
+  }
+}
+
+// Merge changed tiles into rects, or set the count to -1 if the frame must be drawn in full
+void RenderQueue::findDirtyRects()
+{
+  bool full = mFullRedraw || !mHasPrevious;
+  int dirtyTiles = 0;
+  mDirtyCount = 0;
+
+  for( int row = 0; row < DIRTY_TILE_ROWS; row++ )
+  {
+    int rowStart = mDirtyCount;
+
+    for( int col = 0; col < DIRTY_TILE_COLS; col++ )
+    {
+      int t = ( row * DIRTY_TILE_COLS ) + col;
+      bool dirty = mFrameHashes[ t ] != mTileHashes[ t ];
+
+      mTileHashes[ t ] = mFrameHashes[ t ];
+      mFrameHashes[ t ] = HASH_BASIS;
+
+      if( !dirty || full )
+      {
+	continue;
+      }
+
+      dirtyTiles++;
+
+      // Extend the run of dirty tiles to the left
+      SDL_Rect* last = mDirtyCount > rowStart ? &mDirtyRects[ mDirtyCount - 1 ] : NULL;
+      if( last != NULL && last->x + last->w == col * DIRTY_TILE_SIZE )
+      {
+	last->w += DIRTY_TILE_SIZE;
+      }
+      else
+      {
+	SDL_Rect r = { col * DIRTY_TILE_SIZE, row * DIRTY_TILE_SIZE, DIRTY_TILE_SIZE, DIRTY_TILE_SIZE };
+	mDirtyRects[ mDirtyCount++ ] = r;
+      }
+    }
+
+    // Join runs with an identical run on the row above
+    for( int i = rowStart; i < mDirtyCount; i++ )
+    {
+      for( int j = 0; j < rowStart; j++ )
+      {
+	SDL_Rect& above = mDirtyRects[ j ];
+	if( above.x == mDirtyRects[ i ].x && above.w == mDirtyRects[ i ].w && above.y + above.h == mDirtyRects[ i ].y )
+	{
+	  above.h += DIRTY_TILE_SIZE;
+	  mDirtyRects[ i ] = mDirtyRects[ --mDirtyCount ];
+	  i--;
+	  break;
+	}
+      }
+    }
+  }
+
+  mHasPrevious = true;
+
+  if( full || dirtyTiles * 100 >= DIRTY_FULL_REDRAW_PERCENT * DIRTY_TILES )
+  {
+    mDirtyCount = -1;
+  }
+}
+
+// Clear each dirty rect and draw only the commands overlapping it
+void RenderQueue::drawDirtyRects()
+{
+  std::sort( mSorted, mSorted + mCount, commandLess );
+
+  for( int i = 0; i < mDirtyCount; i++ )
+  {
+    SDL_Rect& r = mDirtyRects[ i ];
+
+    SDL_RenderSetClipRect( gRenderer, &r );
+    SDL_SetRenderDrawColor( gRenderer, 0xFF, 0xFF, 0xFF, 0xFF );
+    SDL_RenderFillRect( gRenderer, &r );
+
+    SDL_Texture* lastTexture = NULL;
+    int lastAlpha = -1;
+    for( int j = 0; j < mCount; j++ )
+    {
+      RenderCommand* c = mSorted[ j ];
+      if( !SDL_HasIntersection( &c->quad, &r ) )
+      {
+	continue;
+      }
+
+      if( c->texture != lastTexture )
+      {
+	lastTexture = c->texture;
+	lastAlpha = -1;
+	mFrameBatches++;
+      }
+
+      if( c->alpha != lastAlpha )
+      {
+	lastAlpha = c->alpha;
+	SDL_SetTextureAlphaMod( c->texture, c->alpha );
+      }
+      SDL_RenderCopy( gRenderer, c->texture, c->clipped ? &c->clip : NULL, &c->quad );
+      mFrameCommands++;
+    }
+  }
+
+  SDL_RenderSetClipRect( gRenderer, NULL );
+  mCount = 0;
+}
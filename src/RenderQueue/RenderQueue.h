@@ -0,0 +1,63 @@
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+
+// Records texture copies for a frame and submits them sorted by layer and texture
+class RenderQueue
+{
+  public:
+  RenderQueue();
+
+  void setBackend( RenderBackend backend );
+  RenderBackend getBackend();
+  void setLayer( RenderLayer layer );
+  void push( SDL_Texture* texture, SDL_Rect* clip, SDL_Rect& quad, Uint8 alpha, Uint32 version = 0 );
+#if SDL_VERSION_ATLEAST( 2, 0, 18 )
+  void pushGeometry( SDL_Texture* texture, SDL_Vertex* vertices, int numVertices, int* indices, int numIndices );
+#endif
+  void submit();
+
+  void setDirtyTracking( bool tracking );
+  bool getDirtyTracking();
+  void invalidate();
+  void present();
+
+  int getCommandCount();
+  int getBatchCount();
+  int getDirtyRectCount();
+
+  private:
+  void flush();
+  bool isTrackingScreen();
+  void beginFullRedraw();
+  void hashCommand( RenderCommand& c, Uint32 version );
+  void findDirtyRects();
+  void drawDirtyRects();
+
+  RenderCommand mCommands[ RENDER_QUEUE_SIZE ];
+  RenderCommand* mSorted[ RENDER_QUEUE_SIZE ];
+  int mCount;
+  RenderLayer mLayer;
+  RenderBackend mBackend;
+
+  // Totals for the frame being recorded and the last submitted frame
+  int mFrameCommands;
+  int mFrameBatches;
+  int mCommandCount;
+  int mBatchCount;
+
+  // Hash of every command touching each screen tile, this frame and last
+  bool mDirtyTracking;
+  bool mHasPrevious;
+  bool mFullRedraw;
+  Uint32 mFrameHashes[ DIRTY_TILES ];
+  Uint32 mTileHashes[ DIRTY_TILES ];
+  SDL_Rect mDirtyRects[ DIRTY_TILES ];
+  int mDirtyCount;
+};
+
+#endif
@@ -0,0 +1,162 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <string>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../LTexture/LTexture.h"
+#include "../textures/textures.h"
+#include "../Square/Square.h"
+#include "RendererBenchmark.h"
+
+RendererBenchmark::RendererBenchmark()
+{
+
+}
+
+// Time every driver able to render to textures and return the fastest, or -1
+int RendererBenchmark::pickFastest( SDL_Window* window, Uint32 flags )
+{
+  int fastest = -1;
+  float fastestTime = 0.0f;
+
+  for( int i = 0; i < SDL_GetNumRenderDrivers(); i++ )
+  {
+    float frameTime = measure( window, i, flags );
+    if( frameTime < 0.0f )
+    {
+      continue;
+    }
+
+    printf( "Renderer %s: %.2f ms per frame\n", getDriverName( i ).c_str(), frameTime );
+
+    if( fastest == -1 || frameTime < fastestTime )
+    {
+      fastest = i;
+      fastestTime = frameTime;
+    }
+  }
+
+  return fastest;
+}
+
+// Index of the driver with the given name, or -1 to let SDL choose
+int RendererBenchmark::findDriver( std::string name )
+{
+  for( int i = 0; i < SDL_GetNumRenderDrivers(); i++ )
+  {
+    if( getDriverName( i ) == name )
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+std::string RendererBenchmark::getDriverName( int driver )
+{
+  SDL_RendererInfo info;
+  if( SDL_GetRenderDriverInfo( driver, &info ) != 0 )
+  {
+    return "";
+  }
+
+  return info.name;
+}
+
+// Average milliseconds per frame on one driver, or -1 if it cannot be used
+float RendererBenchmark::measure( SDL_Window* window, int driver, Uint32 flags )
+{
+  SDL_RendererInfo info;
+  if( SDL_GetRenderDriverInfo( driver, &info ) != 0 || !( info.flags & SDL_RENDERER_TARGETTEXTURE ) )
+  {
+    return -1.0f;
+  }
+
+  // Let the driver say what it is, and never wait on the display while timing
+  gRenderer = SDL_CreateRenderer( window, driver, flags & ~( SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC ) );
+  if( gRenderer == NULL )
+  {
+    return -1.0f;
+  }
+
+  float frameTime = -1.0f;
+
+  if( loadTextures() )
+  {
+    Uint64 start = 0;
+
+    for( int i = 0; i < WARMUP_FRAMES + TIMED_FRAMES; i++ )
+    {
+      if( i == WARMUP_FRAMES )
+      {
+	start = SDL_GetPerformanceCounter();
+      }
+
+      drawFrame( i );
+    }
+
+    // Reading a pixel back waits for the driver to finish the queued frames
+    SDL_Rect pixelRect = { 0, 0, 1, 1 };
+    Uint32 pixel;
+    SDL_RenderReadPixels( gRenderer, &pixelRect, SDL_PIXELFORMAT_RGBA32, &pixel, 4 );
+
+    frameTime = 1000.0f * ( SDL_GetPerformanceCounter() - start ) / SDL_GetPerformanceFrequency() / TIMED_FRAMES;
+  }
+
+  freeTextures();
+  SDL_DestroyRenderer( gRenderer );
+  gRenderer = NULL;
+
+  return frameTime;
+}
+
+bool RendererBenchmark::loadTextures()
+{
+  bool success = mBackground.loadFromFile( "images/bg1.png" );
+  success = mPlayBG.loadFromFile( "images/play_bg.png" ) && success;
+  success = mHands.loadFromFile( "images/hands1.png" ) && success;
+  success = mBlocks.loadFromFile( "images/blocks.png" ) && success;
+
+  mHands.setBlendMode( SDL_BLENDMODE_BLEND );
+  mBlocks.setBlendMode( SDL_BLENDMODE_BLEND );
+
+  return success;
+}
+
+void RendererBenchmark::freeTextures()
+{
+  mBackground.free();
+  mPlayBG.free();
+  mHands.free();
+  mBlocks.free();
+}
+
+// Background, board frame, a fading hand, and a full board of Squares
+void RendererBenchmark::drawFrame( int frame )
+{
+  SDL_SetRenderDrawColor( gRenderer, 0xFF, 0xFF, 0xFF, 0xFF );
+  SDL_RenderClear( gRenderer );
+
+  gRenderQueue.setLayer( RENDER_LAYER_BACKGROUND );
+  mBackground.render( 0, 0 );
+
+  gRenderQueue.setLayer( RENDER_LAYER_DECORATION );
+  SDL_Rect handClip = { 0, ( frame % 5 ) * 275, 850, 275 };
+  mHands.setAlpha( ( frame * 8 ) % 256 );
+  mHands.render( 0, ( SCREEN_HEIGHT / 2 ) - 138, &handClip );
+
+  gRenderQueue.setLayer( RENDER_LAYER_FRAME );
+  mPlayBG.render( 0, 0 );
+
+  gRenderQueue.setLayer( RENDER_LAYER_SQUARES );
+  for( int i = 0; i < TOTAL_SQUARES; i++ )
+  {
+    SDL_Rect clip = { ( ( i + frame ) % SQUARE_SPRITE_TOTAL ) * Square::SQUARE_WIDTH, 0, Square::SQUARE_WIDTH, Square::SQUARE_HEIGHT };
+    mBlocks.render( 300 + ( ( i % TOTAL_COLS ) * Square::SQUARE_WIDTH ), ( i / TOTAL_COLS ) * Square::SQUARE_HEIGHT, &clip );
+  }
+
+  gRenderQueue.submit();
+  SDL_RenderPresent( gRenderer );
+}
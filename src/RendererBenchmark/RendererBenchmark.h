@@ -0,0 +1,34 @@
+#ifndef RENDERERBENCHMARK_H
+#define RENDERERBENCHMARK_H
+
+#include <SDL2/SDL.h>
+#include <string>
+
+#include "../LTexture/LTexture.h"
+
+// Draws a representative play frame on every render driver and keeps the fastest
+class RendererBenchmark
+{
+  public:
+  RendererBenchmark();
+
+  int pickFastest( SDL_Window* window, Uint32 flags );
+  int findDriver( std::string name );
+  std::string getDriverName( int driver );
+
+  private:
+  static const int WARMUP_FRAMES = 10;
+  static const int TIMED_FRAMES = 60;
+
+  float measure( SDL_Window* window, int driver, Uint32 flags );
+  bool loadTextures();
+  void freeTextures();
+  void drawFrame( int frame );
+
+  LTexture mBackground;
+  LTexture mPlayBG;
+  LTexture mHands;
+  LTexture mBlocks;
+};
+
+#endif
@@ -5,27 +5,28 @@
 #include <string>
 
 #include "../constants.h"
+#include "../globals/globals.h"
 #include "../GameState/GameState.h"
 
 class ScoreList : public GameState
 {
   public:
-  ScoreList( int score, SDL_Rect& listArea );
+  ScoreList( Stats* stats );
   ~ScoreList();
-  
+
+  void enter();
+  void exit();
   void handleEvent( SDL_Event& e );
   void logic();
-  void render();
+  void snapshot( FrameSnapshot& s );
 
   private:
-  SDL_Point mListCenters[ TOTAL_SCORES ];
-  SDL_Point mListPositions[ TOTAL_SCORES ];
-  SDL_Point mNewScorePosition;
+  Stats* mStats;
   int mNewScore;
   int mNewRank;
   std::string mName;
   bool mGotHighScore;
-  bool mNameChanged;
+  bool mSaved;
 };
 
 #endif
@@ -0,0 +1,187 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <string>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../LTexture/LTexture.h"
+#include "../textures/textures.h"
+#include "../Timeline/Timeline.h"
+#include "../View/View.h"
+#include "ScoreListView.h"
+
+ScoreListView::ScoreListView( SDL_Rect& listArea )
+{
+  for( int i = 0; i < TOTAL_SCORES; i++ )
+  {
+    mListCenters[ i ].x = listArea.x + ( listArea.w / 2 );
+    mListCenters[ i ].y = listArea.y + ( i * gListClips[ 0 ].h ) + ( gListClips[ 0 ].h / 2 );
+  }
+
+  mGotHighScore = false;
+  mNameLoaded = false;
+  mPreparedScore = 0;
+  mPreparedGeneration = 0;
+
+  mPromptTrack = addPulseTrack( mTimeline );
+  addListTracks( mTimeline, 0, mListTracks );
+}
+
+ScoreListView::~ScoreListView()
+{
+
+}
+
+void ScoreListView::enter( FrameSnapshot& s )
+{
+  bool prepared = mPreparedGeneration == sTextGeneration && mPreparedScore == s.newScore;
+  mPreparedGeneration = 0;
+
+  mGotHighScore = s.gotHighScore;
+
+  if( mGotHighScore )
+  {
+    if( !prepared )
+    {
+      loadScoreText( s.newScore );
+      loadNameText( "" );
+    }
+
+    gListTexture.setAlpha( 255 );
+  }
+  else
+  {
+    layoutListText( s );
+  }
+
+  mTimeline.reset();
+}
+
+// Render the text of the coming list while the game over screen plays, from its
+// snapshot, so entering the list renders nothing
+void ScoreListView::prepare( FrameSnapshot& s )
+{
+  loadScoreText( s.stats.score );
+  loadNameText( "" );
+  loadListText( s.scores );
+
+  mPreparedScore = s.stats.score;
+  mPreparedGeneration = sTextGeneration;
+}
+
+void ScoreListView::render( FrameSnapshot& s, float interpolation )
+{
+  // Show the new list once the player has entered a name
+  if( mGotHighScore && !s.gotHighScore )
+  {
+    layoutListText( s );
+  }
+  mGotHighScore = s.gotHighScore;
+
+  int currentTicks = getRenderTicks( s, interpolation );
+  // Interpolation must not run past the end of the list fade
+  if( currentTicks > 9999 )
+  {
+    currentTicks = 9999;
+  }
+
+  mTimeline.evaluate( currentTicks );
+
+  if( mTimeline.hasChanged( mPromptTrack ) )
+  {
+    gEnterNameTexture.setAlpha( mTimeline.getValue( mPromptTrack ) );
+  }
+
+  for( int i = 0; i < TOTAL_SCORES; i++ )
+  {
+    if( mTimeline.hasChanged( mListTracks[ i ] ) )
+    {
+      gListTextTextures[ i ].setAlpha( mTimeline.getValue( mListTracks[ i ] ) );
+      gListTextTextures[ i + TOTAL_SCORES ].setAlpha( mTimeline.getValue( mListTracks[ i ] ) );
+    }
+  }
+
+  gRenderQueue.setLayer( RENDER_LAYER_BACKGROUND );
+  gBlankBGTexture.render( 0, 0 );
+
+  // If the player is entering a high score
+  if( mGotHighScore )
+  {
+    gRenderQueue.setLayer( RENDER_LAYER_PROMPT );
+    gEnterNameTexture.render( 0, 0 );
+
+    gRenderQueue.setLayer( RENDER_LAYER_PANEL );
+    gListTexture.render( 275, 225, &gListClips[ s.newRank ] );
+
+    if( !mNameLoaded || mName != s.name )
+    {
+      loadNameText( s.name );
+    }
+
+    gRenderQueue.setLayer( RENDER_LAYER_LABEL );
+    gNewScoreTextTextures[ 0 ].render( mNewScorePosition.x, mNewScorePosition.y );
+    gNewScoreTextTextures[ 1 ].render( mListCenters[ TOTAL_SCORES / 2 ].x + 13, mListCenters[ TOTAL_SCORES / 2 ].y + 13 );
+  }
+  // If the player is not entering a high score
+  else
+  {
+    int x = 275, y = 25;
+    
+    for( int i = 0; i < TOTAL_SCORES; i++ )
+    {
+      gListTexture.setAlpha( mTimeline.getValue( mListTracks[ i ] ) );
+      gRenderQueue.setLayer( RENDER_LAYER_PANEL );
+      gListTexture.render( x, y + ( i * 100 ), &gListClips[ i ] );
+      gRenderQueue.setLayer( RENDER_LAYER_LABEL );
+      gListTextTextures[ i ].render( mListPositions[ i ].x, mListPositions[ i ].y );
+      gListTextTextures[ i + TOTAL_SCORES ].render( mListCenters[ i ].x + 13, mListCenters[ i ].y + 13 );
+    }
+  }
+}
+
+// Place the name and score of every high score, rendering them if they changed
+void ScoreListView::layoutListText( FrameSnapshot& s )
+{
+  loadListText( s.scores );
+
+  for( int i = 0; i < TOTAL_SCORES; i++ )
+  {
+    gListTextTextures[ i ].setAlpha( 0 );
+    gListTextTextures[ i + TOTAL_SCORES ].setAlpha( 0 );
+    mListPositions[ i ].x = mListCenters[ i ].x - ( gListTextTextures[ i ].getWidth() / 2 );
+    mListPositions[ i ].y = mListCenters[ i ].y - ( gListTextTextures[ i ].getHeight() / 2 );
+  }
+
+  // The new text starts hidden, so its alpha must be set again
+  mTimeline.reset();
+}
+
+// Render the score of the game just played
+void ScoreListView::loadScoreText( int score )
+{
+  SDL_Color scoreColor = { 0, 0, 0 };
+
+  std::string text = std::to_string( score );
+  gNewScoreTextTextures[ 1 ].loadFromRenderedText( text.c_str(), scoreColor );
+}
+
+// Render the name being entered, centered in the new score's row
+void ScoreListView::loadNameText( std::string name )
+{
+  SDL_Color nameColor = { 255, 255, 255 };
+
+  mName = name;
+  mNameLoaded = true;
+
+  if( mName != "" )
+  {
+    gNewScoreTextTextures[ 0 ].loadFromRenderedText( mName.c_str(), nameColor );
+  }
+  else
+  {
+    gNewScoreTextTextures[ 0 ].loadFromRenderedText( " ", nameColor );
+  }
+
+  mNewScorePosition.x = mListCenters[ TOTAL_SCORES / 2 ].x - ( gNewScoreTextTextures[ 0 ].getWidth() / 2 );
+  mNewScorePosition.y = mListCenters[ TOTAL_SCORES / 2 ].y - ( gNewScoreTextTextures[ 0 ].getHeight() / 2 );
+}
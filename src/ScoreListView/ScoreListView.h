@@ -0,0 +1,43 @@
+#ifndef SCORELISTVIEW_H
+#define SCORELISTVIEW_H
+
+#include <SDL2/SDL.h>
+#include <string>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../Timeline/Timeline.h"
+#include "../View/View.h"
+
+class ScoreListView : public View
+{
+  public:
+  ScoreListView( SDL_Rect& listArea );
+  ~ScoreListView();
+
+  void enter( FrameSnapshot& s );
+  void prepare( FrameSnapshot& s );
+  void render( FrameSnapshot& s, float interpolation );
+
+  private:
+  void layoutListText( FrameSnapshot& s );
+  void loadScoreText( int score );
+  void loadNameText( std::string name );
+
+  SDL_Point mListCenters[ TOTAL_SCORES ];
+  SDL_Point mListPositions[ TOTAL_SCORES ];
+  SDL_Point mNewScorePosition;
+  std::string mName;
+  bool mGotHighScore;
+  bool mNameLoaded;
+
+  // Score whose text prepare() rendered, and the text generation it belongs to
+  int mPreparedScore;
+  Uint32 mPreparedGeneration;
+
+  Timeline mTimeline;
+  int mPromptTrack;
+  int mListTracks[ TOTAL_SCORES ];
+};
+
+#endif
@@ -0,0 +1,313 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../IOWorker/IOWorker.h"
+#include "ScoreStore.h"
+
+ScoreStore gScoreStore;
+
+// Higher scores first, and a new score goes below the scores it ties with
+static bool higherScore( const Score& a, const Score& b )
+{
+  return a.score > b.score;
+}
+
+// Initialize member variables
+ScoreStore::ScoreStore()
+{
+  mOpen = false;
+  mGeneration = 0;
+  mJournalRecords = 0;
+}
+
+// Fold any journal records into the snapshot
+ScoreStore::~ScoreStore()
+{
+  close();
+}
+
+// Load the snapshot and every intact journal record written after it
+bool ScoreStore::open( std::string snapshotPath, std::string journalPath )
+{
+  close();
+
+  mSnapshotPath = snapshotPath;
+  mJournalPath = journalPath;
+  mScores.clear();
+  mGeneration = 0;
+  mJournalRecords = 0;
+
+  if( !loadSnapshot() )
+  {
+    // The table every new install starts with
+    for( int i = 0; i < TOTAL_SCORES; i++ )
+    {
+      Score score;
+      memset( &score, 0, sizeof( score ) );
+      strcpy( score.name, "TAKASHI" );
+      score.score = 500 - ( i * 100 );
+      insert( score );
+    }
+  }
+
+  mOpen = true;
+
+  // Keep appending to a journal that ends cleanly, otherwise fold it into a new snapshot
+  if( replayJournal() )
+  {
+    return true;
+  }
+
+  return compact();
+}
+
+// Fold the journal into the snapshot
+void ScoreStore::close()
+{
+  if( !mOpen )
+  {
+    return;
+  }
+
+  if( mJournalRecords > 0 )
+  {
+    compact();
+  }
+
+  mOpen = false;
+}
+
+// Record a finished game and queue its journal record
+bool ScoreStore::add( std::string name, int score )
+{
+  ScoreRecord record;
+  memset( &record, 0, sizeof( record ) );
+  strncpy( record.score.name, name.c_str(), sizeof( record.score.name ) - 1 );
+  record.score.score = score;
+  record.checksum = checksum( &record.score, sizeof( record.score ) );
+
+  insert( record.score );
+
+  if( !mOpen || !gIOWorker.append( mJournalPath, &record, sizeof( record ) ) )
+  {
+    printf( "Warning: Unable to save score to %s!\n", mJournalPath.c_str() );
+    return false;
+  }
+
+  mJournalRecords++;
+  if( mJournalRecords >= SCORE_COMPACT_RECORDS )
+  {
+    compact();
+  }
+
+  return true;
+}
+
+// Place a score would take in the list, 0 being the top
+int ScoreStore::getRank( int score )
+{
+  Score key;
+  key.score = score;
+
+  return std::upper_bound( mScores.begin(), mScores.end(), key, higherScore ) - mScores.begin();
+}
+
+// Copy the highest scores, padding with empty ones when there are fewer
+void ScoreStore::getTop( Score* scores, int count )
+{
+  for( int i = 0; i < count; i++ )
+  {
+    if( i < (int)mScores.size() )
+    {
+      scores[ i ] = mScores[ i ];
+    }
+    else
+    {
+      memset( &scores[ i ], 0, sizeof( Score ) );
+    }
+  }
+}
+
+int ScoreStore::getCount()
+{
+  return mScores.size();
+}
+
+// Read the sorted snapshot, or the five raw scores saved before there was a journal
+bool ScoreStore::loadSnapshot()
+{
+  FILE* file = fopen( mSnapshotPath.c_str(), "rb" );
+  if( file == NULL )
+  {
+    return false;
+  }
+
+  bool loaded = false;
+
+  ScoreFileHeader header;
+  if( fread( &header, sizeof( header ), 1, file ) == 1 && header.magic == SNAPSHOT_MAGIC )
+  {
+    std::vector<Score> scores( header.count <= (Uint32)SCORE_STORE_CAPACITY ? header.count : 0 );
+    if( scores.size() == header.count && fread( scores.data(), sizeof( Score ), scores.size(), file ) == scores.size() &&
+	checksum( scores.data(), scores.size() * sizeof( Score ) ) == header.checksum )
+    {
+      mScores = scores;
+      mGeneration = header.generation;
+      loaded = true;
+    }
+    else
+    {
+      printf( "Warning: Score snapshot %s is damaged!\n", mSnapshotPath.c_str() );
+    }
+  }
+  else
+  {
+    Score scores[ TOTAL_SCORES ];
+    rewind( file );
+    if( fread( scores, sizeof( Score ), TOTAL_SCORES, file ) == TOTAL_SCORES )
+    {
+      for( int i = 0; i < TOTAL_SCORES; i++ )
+      {
+	scores[ i ].name[ sizeof( scores[ i ].name ) - 1 ] = '\0';
+	insert( scores[ i ] );
+      }
+      loaded = true;
+    }
+  }
+
+  fclose( file );
+  return loaded;
+}
+
+// Add every record of a journal written for the loaded snapshot, stopping at
+// the first damaged one. Whether the journal ended cleanly is returned.
+bool ScoreStore::replayJournal()
+{
+  FILE* file = fopen( mJournalPath.c_str(), "rb" );
+  if( file == NULL )
+  {
+    return false;
+  }
+
+  bool clean = false;
+
+  ScoreFileHeader header;
+  if( fread( &header, sizeof( header ), 1, file ) == 1 && header.magic == JOURNAL_MAGIC && header.generation == mGeneration )
+  {
+    clean = true;
+
+    ScoreRecord record;
+    size_t size;
+    while( ( size = fread( &record, 1, sizeof( record ), file ) ) == sizeof( record ) )
+    {
+      if( checksum( &record.score, sizeof( record.score ) ) != record.checksum )
+      {
+	break;
+      }
+
+      record.score.name[ sizeof( record.score.name ) - 1 ] = '\0';
+      insert( record.score );
+      mJournalRecords++;
+    }
+
+    // A record cut short by a crash, or damaged on disk
+    if( size != 0 )
+    {
+      printf( "Warning: Score journal %s ends in a damaged record, keeping the %d before it\n", mJournalPath.c_str(), mJournalRecords );
+      clean = false;
+    }
+  }
+
+  fclose( file );
+  return clean;
+}
+
+// Write every score as the next generation's snapshot, then begin its empty
+// journal. The journal is only replaced once the snapshot is on disk, so a
+// snapshot that cannot be written leaves the old pair of files in place.
+bool ScoreStore::compact()
+{
+  ScoreFileHeader header;
+  header.magic = SNAPSHOT_MAGIC;
+  header.generation = mGeneration + 1;
+  header.count = mScores.size();
+  header.checksum = checksum( mScores.data(), mScores.size() * sizeof( Score ) );
+
+  if( !gIOWorker.replace( mSnapshotPath, &header, sizeof( header ), mScores.data(), mScores.size() * sizeof( Score ) ) )
+  {
+    printf( "Warning: Unable to write score snapshot %s!\n", mSnapshotPath.c_str() );
+    return false;
+  }
+
+  // From here the old journal no longer matches and is never replayed
+  mGeneration = header.generation;
+
+  return startJournal();
+}
+
+// Replace the journal with an empty one for the current generation, after the snapshot
+bool ScoreStore::startJournal()
+{
+  ScoreFileHeader header;
+  header.magic = JOURNAL_MAGIC;
+  header.generation = mGeneration;
+  header.count = 0;
+  header.checksum = 0;
+
+  mJournalRecords = 0;
+
+  if( !gIOWorker.replaceAfter( mSnapshotPath, mJournalPath, &header, sizeof( header ), NULL, 0 ) )
+  {
+    printf( "Warning: Unable to start score journal %s!\n", mJournalPath.c_str() );
+    return false;
+  }
+
+  return true;
+}
+
+// Keep a score in order, dropping the lowest once the store is full
+void ScoreStore::insert( Score& score )
+{
+  mScores.insert( std::upper_bound( mScores.begin(), mScores.end(), score, higherScore ), score );
+
+  if( (int)mScores.size() > SCORE_STORE_CAPACITY )
+  {
+    mScores.pop_back();
+  }
+}
+
+// CRC-32 of a block of bytes
+Uint32 ScoreStore::checksum( const void* data, size_t size )
+{
+  static Uint32 table[ 256 ];
+  static bool tableReady = false;
+
+  if( !tableReady )
+  {
+    for( Uint32 i = 0; i < 256; i++ )
+    {
+      Uint32 c = i;
+      for( int k = 0; k < 8; k++ )
+      {
+	c = ( c & 1 ) ? 0xEDB88320 ^ ( c >> 1 ) : c >> 1;
+      }
+      table[ i ] = c;
+    }
+    tableReady = true;
+  }
+
+  const Uint8* bytes = (const Uint8*)data;
+  Uint32 crc = 0xFFFFFFFF;
+  for( size_t i = 0; i < size; i++ )
+  {
+    crc = table[ ( crc ^ bytes[ i ] ) & 0xFF ] ^ ( crc >> 8 );
+  }
+
+  return crc ^ 0xFFFFFFFF;
+}
@@ -0,0 +1,52 @@
+#ifndef SCORESTORE_H
+#define SCORESTORE_H
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+
+#include "../globals/globals.h"
+
+// Every finished game's score, sorted from highest to lowest in memory.
+// Each new score is appended to a journal as a checksummed record by the
+// I/O worker, which syncs it to disk moments after add() returns. Every so
+// often the scores are written out as a sorted snapshot and the journal
+// starts over. Both files share a generation number, so a journal already
+// folded into the snapshot is never replayed twice.
+class ScoreStore
+{
+  public:
+  ScoreStore();
+  ~ScoreStore();
+
+  bool open( std::string snapshotPath, std::string journalPath );
+  void close();
+
+  bool add( std::string name, int score );
+  int getRank( int score );
+  void getTop( Score* scores, int count );
+  int getCount();
+
+  private:
+  bool loadSnapshot();
+  bool replayJournal();
+  bool compact();
+  bool startJournal();
+  void insert( Score& score );
+
+  static Uint32 checksum( const void* data, size_t size );
+
+  static const Uint32 SNAPSHOT_MAGIC = 0x31535054; // "TPS1"
+  static const Uint32 JOURNAL_MAGIC = 0x314A5054; // "TPJ1"
+
+  std::vector<Score> mScores;
+  std::string mSnapshotPath;
+  std::string mJournalPath;
+  bool mOpen;
+  Uint32 mGeneration;
+  int mJournalRecords;
+};
+
+extern ScoreStore gScoreStore;
+
+#endif
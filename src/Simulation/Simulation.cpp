@@ -0,0 +1,274 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../Square/Square.h"
+#include "../GameState/GameState.h"
+#include "../Intro/Intro.h"
+#include "../Play/Play.h"
+#include "../GameOver/GameOver.h"
+#include "../ScoreList/ScoreList.h"
+#include "../FramePacer/FramePacer.h"
+#include "../TripleBuffer/TripleBuffer.h"
+#include "../InputQueue/InputQueue.h"
+#include "../ParticleSystem/ParticleSystem.h"
+#include "../Recording/Recording.h"
+#include "../AudioDevice/AudioDevice.h"
+#include "../MusicController/MusicController.h"
+#include "../VoiceManager/VoiceManager.h"
+#include "../AudioLoader/AudioLoader.h"
+#include "../StatsStore/StatsStore.h"
+#include "Simulation.h"
+
+// Create every state once, start in the intro and publish its first snapshot
+Simulation::Simulation( TripleBuffer* snapshots, InputQueue* inputs )
+{
+  mSnapshots = snapshots;
+  mInputs = inputs;
+
+  mStates[ GAME_STATE_NULL ] = NULL;
+  mStates[ GAME_STATE_INTRO ] = new Intro();
+  mStates[ GAME_STATE_PLAY ] = new Play( &mStats, mGridSquares, &mParticles );
+  mStates[ GAME_STATE_GAMEOVER ] = new GameOver( &mStats, mGridSquares );
+  mStates[ GAME_STATE_SCORELIST ] = new ScoreList( &mStats );
+
+  mState = mStates[ GAME_STATE_INTRO ];
+  mState->enter();
+  mStateFlag = GAME_STATE_INTRO;
+  mStateSerial = 0;
+
+  mRecording = NULL;
+  mStep = 0;
+  mLive = false;
+
+  mPacer.setMode( PACING_MODE_CAPPED, LOGIC_TICKS_PER_SECOND );
+  mThread = NULL;
+  SDL_AtomicSet( &mQuit, 0 );
+
+  publish();
+}
+
+// Stop the thread and free every state
+Simulation::~Simulation()
+{
+  stop();
+
+  for( int i = 0; i < GAME_STATE_ERROR; i++ )
+  {
+    delete mStates[ i ];
+    mStates[ i ] = NULL;
+  }
+  mState = NULL;
+
+  mSnapshots = NULL;
+  mInputs = NULL;
+  mRecording = NULL;
+}
+
+// Launch the simulation thread
+bool Simulation::start()
+{
+  mThread = SDL_CreateThread( run, "Simulation", this );
+  if( mThread == NULL )
+  {
+    printf( "Could not create simulation thread! SDL Error: %s\n", SDL_GetError() );
+  }
+
+  return mThread != NULL;
+}
+
+// Ask the simulation thread to finish and wait for it
+void Simulation::stop()
+{
+  if( mThread != NULL )
+  {
+    SDL_AtomicSet( &mQuit, 1 );
+    SDL_WaitThread( mThread, NULL );
+    mThread = NULL;
+  }
+}
+
+// Handle queued input, run one logic step, and publish the result
+bool Simulation::step()
+{
+  SDL_Event e;
+  while( mInputs->pop( e ) )
+  {
+    if( mRecording != NULL && mRecording->isActive() && ( e.type == SDL_KEYDOWN || e.type == SDL_KEYUP ) )
+    {
+      mRecording->add( mStep, e );
+    }
+
+    // Replayed events carry the timestamps of the session that recorded them
+    if( mLive && e.type == SDL_KEYDOWN )
+    {
+      gAudioDevice.noteInput( e.key.timestamp );
+    }
+
+    mState->handleEvent( e );
+  }
+
+  // Start any track waiting on the one that just finished
+  gMusicController.update();
+
+  if( mState->getNextState() == GAME_STATE_NULL )
+  {
+    mState->logic();
+  }
+
+  // Sound effects asked for during the step start together
+  gVoiceManager.update();
+
+  mStep++;
+
+  bool success = changeState();
+
+  publish();
+
+  return success;
+}
+
+// Record every game played from now on
+void Simulation::setRecording( Recording* recording )
+{
+  mRecording = recording;
+}
+
+// Leave the current state and start a game that replays a recording
+void Simulation::beginReplay( Uint32 seed )
+{
+  mState->exit();
+  beginGame( seed );
+
+  mStateFlag = GAME_STATE_PLAY;
+  mStateSerial++;
+  mParticles.clear();
+}
+
+// Logic steps run since the current game began
+Uint32 Simulation::getStep()
+{
+  return mStep;
+}
+
+// Thread entry point stepping logic at a fixed rate
+int Simulation::run( void* data )
+{
+  Simulation* simulation = (Simulation*)data;
+  simulation->mLive = true;
+
+  while( SDL_AtomicGet( &simulation->mQuit ) == 0 )
+  {
+    simulation->mPacer.beginFrame();
+
+    while( simulation->mPacer.stepLogic() )
+    {
+      if( !simulation->step() )
+      {
+	return 1;
+      }
+
+      gAudioDevice.checkUnderruns();
+    }
+
+    simulation->mPacer.endFrame();
+  }
+
+  return 0;
+}
+
+// Switch to the state the current one asked for
+bool Simulation::changeState()
+{
+  GameStateFlag nextState = mState->getNextState();
+
+  switch( nextState )
+  {
+    case GAME_STATE_NULL:
+      return true;
+
+    case GAME_STATE_PLAY:
+      mState->exit();
+      beginGame( (Uint32)time( NULL ) ^ (Uint32)SDL_GetPerformanceCounter() );
+      break;
+
+    case GAME_STATE_INTRO:
+    case GAME_STATE_GAMEOVER:
+    case GAME_STATE_SCORELIST:
+      mState->exit();
+
+      // Reopening the device with a larger buffer cuts every sound, which
+      // goes unnoticed as a menu starts its own music. Sounds still loading
+      // in the background would fail while the device is closed.
+      if( ( nextState == GAME_STATE_INTRO || nextState == GAME_STATE_SCORELIST ) && gAudioDevice.isGrowPending() && gAudioLoader.isFinished() &&
+	  gAudioDevice.grow() )
+      {
+	gMusicController.reset();
+	gVoiceManager.init();
+      }
+
+      mState = mStates[ nextState ];
+      mState->enter();
+      break;
+
+    default:
+      printf( "Error found. Exiting game\n" );
+      mStateFlag = GAME_STATE_ERROR;
+      return false;
+  }
+
+  // Every finished game played live adds a row to the stats
+  if( mLive && mStateFlag == GAME_STATE_PLAY && nextState == GAME_STATE_GAMEOVER )
+  {
+    gStatsStore.add( mStats, (Uint32)time( NULL ) );
+  }
+
+  // A recorded game ends once its game over screen is left
+  if( mRecording != NULL && mRecording->isActive() && mStateFlag == GAME_STATE_GAMEOVER )
+  {
+    mRecording->end( mStep );
+    mRecording->save( RECORDING_PATH );
+  }
+
+  mStateFlag = nextState;
+  mStateSerial++;
+  mParticles.clear();
+
+  return true;
+}
+
+// Fill the write buffer from the current state and hand it to the renderer
+void Simulation::publish()
+{
+  FrameSnapshot* s = mSnapshots->getWriteBuffer();
+
+  s->state = mStateFlag;
+  s->stateSerial = mStateSerial;
+
+  if( mStateFlag != GAME_STATE_ERROR )
+  {
+    mState->snapshot( *s );
+  }
+  mParticles.snapshot( s->particles );
+
+  s->publishTime = SDL_GetPerformanceCounter();
+
+  mSnapshots->publish();
+}
+
+// Seed the random pieces so the game can be replayed, then start playing
+void Simulation::beginGame( Uint32 seed )
+{
+  srand( seed );
+  mState = mStates[ GAME_STATE_PLAY ];
+  mState->enter();
+  mStep = 0;
+
+  if( mRecording != NULL )
+  {
+    mRecording->begin( seed );
+  }
+}
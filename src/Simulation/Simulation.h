@@ -0,0 +1,57 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../Square/Square.h"
+#include "../GameState/GameState.h"
+#include "../FramePacer/FramePacer.h"
+#include "../TripleBuffer/TripleBuffer.h"
+#include "../InputQueue/InputQueue.h"
+#include "../ParticleSystem/ParticleSystem.h"
+#include "../Recording/Recording.h"
+#include "../AudioDevice/AudioDevice.h"
+#include "../MusicController/MusicController.h"
+#include "../VoiceManager/VoiceManager.h"
+
+// Runs game states at a fixed rate and publishes a snapshot after every step
+class Simulation
+{
+  public:
+  Simulation( TripleBuffer* snapshots, InputQueue* inputs );
+  ~Simulation();
+
+  bool start();
+  void stop();
+  bool step();
+
+  void setRecording( Recording* recording );
+  void beginReplay( Uint32 seed );
+  Uint32 getStep();
+
+  private:
+  static int run( void* data );
+  bool changeState();
+  void publish();
+  void beginGame( Uint32 seed );
+
+  TripleBuffer* mSnapshots;
+  InputQueue* mInputs;
+  GameState* mStates[ GAME_STATE_ERROR ];
+  GameState* mState;
+  GameStateFlag mStateFlag;
+  int mStateSerial;
+  Stats mStats;
+  Square mGridSquares[ TOTAL_SQUARES ];
+  ParticleSystem mParticles;
+  Recording* mRecording;
+  Uint32 mStep;
+  bool mLive;
+  FramePacer mPacer;
+  SDL_Thread* mThread;
+  SDL_atomic_t mQuit;
+};
+
+#endif
@@ -93,17 +93,29 @@ void Square::replace( Square& s )
   mCurrentSprite = s.mCurrentSprite;
 } 
 
+// Show a sprite without changing state
+void Square::setSprite( int sprite )
+{
+  mCurrentSprite = (SquareSprite)sprite;
+}
+
 // Adjust alpha
 void Square::setAlpha( Uint8 alpha )
 {
   mAlpha = alpha;
 }
 
-// Render image at Square
-void Square::render()
+// Render image at Square, optionally shifted by an offset
+void Square::render( int offsetX, int offsetY )
 {
   gSquareSpriteTexture.setAlpha( mAlpha );
-  gSquareSpriteTexture.render( mPosition.x, mPosition.y, &gSquareSpriteClips[ mCurrentSprite ] );
+  gSquareSpriteTexture.render( mPosition.x + offsetX, mPosition.y + offsetY, &gSquareSpriteClips[ mCurrentSprite ] );
+}
+
+// Access position
+SDL_Point Square::getPosition()
+{
+  return mPosition;
 }
 
 // Access state
@@ -111,3 +123,15 @@ int Square::getState()
 {
   return mCurrentState;
 }
+
+// Access sprite
+int Square::getSprite()
+{
+  return mCurrentSprite;
+}
+
+// Access alpha
+Uint8 Square::getAlpha()
+{
+  return mAlpha;
+}
@@ -17,10 +17,14 @@ class Square
   void stop();
   void clear();
   void replace( Square& s );
+  void setSprite( int sprite );
   void setAlpha( Uint8 alpha );
-  void render();
+  void render( int offsetX = 0, int offsetY = 0 );
 
+  SDL_Point getPosition();
   int getState();
+  int getSprite();
+  Uint8 getAlpha();
 
   private:
   SDL_Point mPosition;
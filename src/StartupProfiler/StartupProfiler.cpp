@@ -0,0 +1,127 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "StartupProfiler.h"
+
+// Constructed before main runs, so the clock starts as close to process start as we can get
+StartupProfiler gStartupProfiler;
+
+// Longest phase first
+static bool longerPhase( const StartupPhase& a, const StartupPhase& b )
+{
+  return a.duration > b.duration;
+}
+
+// Initialize member variables
+StartupProfiler::StartupProfiler()
+{
+  mOrigin = SDL_GetPerformanceCounter();
+  mEnabled = false;
+  mFinished = false;
+}
+
+void StartupProfiler::setEnabled( bool enabled )
+{
+  mEnabled = enabled;
+}
+
+bool StartupProfiler::isEnabled()
+{
+  return mEnabled && !mFinished;
+}
+
+// Counter value marking the start of a phase
+Uint64 StartupProfiler::begin()
+{
+  return SDL_GetPerformanceCounter();
+}
+
+// Record a phase running from start until now
+void StartupProfiler::end( std::string name, Uint64 start )
+{
+  add( name, start, SDL_GetPerformanceCounter() - start );
+}
+
+// Record a phase timed elsewhere
+void StartupProfiler::add( std::string name, Uint64 start, Uint64 duration )
+{
+  if( !isEnabled() )
+  {
+    return;
+  }
+
+  StartupPhase phase;
+  strncpy( phase.name, name.c_str(), sizeof( phase.name ) - 1 );
+  phase.name[ sizeof( phase.name ) - 1 ] = '\0';
+  phase.start = start > mOrigin ? start - mOrigin : 0;
+  phase.duration = duration;
+
+  mPhases.push_back( phase );
+}
+
+// Report every phase once the first intro frame is on screen
+void StartupProfiler::finish()
+{
+  if( !isEnabled() )
+  {
+    return;
+  }
+
+  Uint64 total = SDL_GetPerformanceCounter() - mOrigin;
+  mFinished = true;
+
+  if( !write( STARTUP_PROFILE_PATH, total ) )
+  {
+    printf( "Warning: Unable to write startup profile %s!\n", STARTUP_PROFILE_PATH );
+  }
+
+  std::vector<StartupPhase> sorted = mPhases;
+  std::stable_sort( sorted.begin(), sorted.end(), longerPhase );
+
+  printf( "Startup took %.2f ms to the first intro frame\n", toMilliseconds( total ) );
+  printf( "%10s %10s  %s\n", "ms", "start", "phase" );
+  for( unsigned int i = 0; i < sorted.size(); i++ )
+  {
+    printf( "%10.2f %10.2f  %s\n", toMilliseconds( sorted[ i ].duration ), toMilliseconds( sorted[ i ].start ), sorted[ i ].name );
+  }
+}
+
+// Phases in the order they were recorded, as JSON
+bool StartupProfiler::write( std::string path, Uint64 total )
+{
+  FILE* file = fopen( path.c_str(), "w" );
+  if( file == NULL )
+  {
+    return false;
+  }
+
+  fprintf( file, "{\n  \"total_ms\": %.3f,\n  \"phases\": [\n", toMilliseconds( total ) );
+  for( unsigned int i = 0; i < mPhases.size(); i++ )
+  {
+    fprintf( file, "    { \"name\": \"" );
+    for( const char* c = mPhases[ i ].name; *c != '\0'; c++ )
+    {
+      if( *c == '"' || *c == '\\' )
+      {
+	fputc( '\\', file );
+      }
+      fputc( *c, file );
+    }
+    fprintf( file, "\", \"start_ms\": %.3f, \"duration_ms\": %.3f }%s\n", toMilliseconds( mPhases[ i ].start ),
+	     toMilliseconds( mPhases[ i ].duration ), i + 1 < mPhases.size() ? "," : "" );
+  }
+  fprintf( file, "  ]\n}\n" );
+
+  return fclose( file ) == 0;
+}
+
+float StartupProfiler::toMilliseconds( Uint64 ticks )
+{
+  return (float)( ticks * 1000.0 / SDL_GetPerformanceFrequency() );
+}
@@ -0,0 +1,39 @@
+#ifndef STARTUPPROFILER_H
+#define STARTUPPROFILER_H
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+
+#include "../globals/globals.h"
+
+// Times each phase of startup up to the first presented intro frame, then
+// prints them longest first and writes them to a JSON file. Phases are only
+// recorded on the main thread; work done on other threads is added with its
+// own measured start and duration.
+class StartupProfiler
+{
+  public:
+  StartupProfiler();
+
+  void setEnabled( bool enabled );
+  bool isEnabled();
+
+  Uint64 begin();
+  void end( std::string name, Uint64 start );
+  void add( std::string name, Uint64 start, Uint64 duration );
+  void finish();
+
+  private:
+  bool write( std::string path, Uint64 total );
+  float toMilliseconds( Uint64 ticks );
+
+  std::vector<StartupPhase> mPhases;
+  Uint64 mOrigin;
+  bool mEnabled;
+  bool mFinished;
+};
+
+extern StartupProfiler gStartupProfiler;
+
+#endif
@@ -0,0 +1,298 @@
+#include <SDL2/SDL.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../IOWorker/IOWorker.h"
+#include "StatsStore.h"
+
+StatsStore gStatsStore;
+
+// File names of the columns before the per level ones
+static const char* COLUMN_NAMES[ STATS_COLUMN_LEVEL_STEPS ] =
+{
+  "ended",
+  "score",
+  "lines",
+  "level",
+  "steps",
+  "pieces",
+  "keys",
+  "holds",
+  "singles",
+  "doubles",
+  "triples",
+  "tetrises"
+};
+
+// Initialize member variables
+StatsStore::StatsStore()
+{
+  mWritable = false;
+  mRows = 0;
+
+  for( int i = 0; i < STATS_COLUMN_TOTAL; i++ )
+  {
+    mMaps[ i ] = NULL;
+    mMapSizes[ i ] = 0;
+    mIntact[ i ] = false;
+  }
+}
+
+StatsStore::~StatsStore()
+{
+  close();
+}
+
+// Count the games every intact column holds. A writable store also sets
+// missing or damaged columns aside and rebuilds them with a zero for every
+// game, and trims rows left over from a crash, returning whether it can
+// take new games. Nothing is ever trimmed below the shortest intact column,
+// and a store whose columns cannot be lined up is only read. A read-only
+// store returns whether every column was intact.
+bool StatsStore::open( std::string directory, bool writable )
+{
+  close();
+
+  mDirectory = directory;
+  mWritable = writable;
+
+  if( writable )
+  {
+    mkdir( directory.c_str(), 0755 );
+  }
+
+  long sizes[ STATS_COLUMN_TOTAL ];
+  bool damaged[ STATS_COLUMN_TOTAL ];
+  bool intact = true;
+
+  mRows = -1;
+  for( int i = 0; i < STATS_COLUMN_TOTAL; i++ )
+  {
+    mIntact[ i ] = false;
+    damaged[ i ] = false;
+    sizes[ i ] = 0;
+
+    FILE* file = fopen( getPath( i ).c_str(), "rb" );
+    if( file != NULL )
+    {
+      StatsColumnHeader header;
+      if( fread( &header, sizeof( header ), 1, file ) == 1 && header.magic == MAGIC && header.column == (Uint32)i && fseek( file, 0, SEEK_END ) == 0 )
+      {
+	sizes[ i ] = ftell( file );
+	mIntact[ i ] = true;
+
+	int rows = ( sizes[ i ] - sizeof( header ) ) / sizeof( Uint32 );
+	if( mRows < 0 || rows < mRows )
+	{
+	  mRows = rows;
+	}
+      }
+      else
+      {
+	printf( "Warning: Stats column %s is damaged!\n", getPath( i ).c_str() );
+	damaged[ i ] = true;
+      }
+
+      fclose( file );
+    }
+
+    if( !mIntact[ i ] )
+    {
+      intact = false;
+    }
+  }
+
+  if( mRows < 0 )
+  {
+    mRows = 0;
+  }
+
+  if( !writable )
+  {
+    return intact;
+  }
+
+  // Line every column up with the shortest intact one
+  bool success = true;
+  std::vector<Uint32> zeros;
+  for( int i = 0; i < STATS_COLUMN_TOTAL && success; i++ )
+  {
+    if( !mIntact[ i ] )
+    {
+      // Keep a damaged column's bytes for whoever wants to look at them
+      if( damaged[ i ] && rename( getPath( i ).c_str(), ( getPath( i ) + ".damaged" ).c_str() ) != 0 )
+      {
+	success = false;
+	break;
+      }
+
+      if( (int)zeros.size() < mRows )
+      {
+	zeros.resize( mRows, 0 );
+      }
+
+      if( mRows > 0 )
+      {
+	printf( "Warning: Starting stats column %s with %d empty games\n", getPath( i ).c_str(), mRows );
+      }
+
+      StatsColumnHeader header;
+      header.magic = MAGIC;
+      header.column = i;
+      success = gIOWorker.replace( getPath( i ), &header, sizeof( header ), zeros.data(), (size_t)mRows * sizeof( Uint32 ) );
+      mIntact[ i ] = success;
+    }
+    else if( sizes[ i ] > (long)( sizeof( StatsColumnHeader ) + (size_t)mRows * sizeof( Uint32 ) ) )
+    {
+      printf( "Warning: Trimming unfinished rows from %s back to %d games\n", getPath( i ).c_str(), mRows );
+      success = truncate( getPath( i ).c_str(), sizeof( StatsColumnHeader ) + (off_t)mRows * sizeof( Uint32 ) ) == 0;
+    }
+  }
+
+  if( !success )
+  {
+    printf( "Warning: Unable to line up stats columns in %s, new games will not be recorded!\n", directory.c_str() );
+    mWritable = false;
+  }
+
+  return success;
+}
+
+// Unmap every column read so far
+void StatsStore::close()
+{
+  for( int i = 0; i < STATS_COLUMN_TOTAL; i++ )
+  {
+    if( mMaps[ i ] != NULL )
+    {
+      munmap( mMaps[ i ], mMapSizes[ i ] );
+      mMaps[ i ] = NULL;
+      mMapSizes[ i ] = 0;
+    }
+  }
+
+  mRows = 0;
+  mWritable = false;
+}
+
+// Queue a finished game's row, one value appended to each column
+bool StatsStore::add( Stats& stats, Uint32 ended )
+{
+  if( !mWritable )
+  {
+    return false;
+  }
+
+  Uint32 row[ STATS_COLUMN_TOTAL ];
+  row[ STATS_COLUMN_ENDED ] = ended;
+  row[ STATS_COLUMN_SCORE ] = stats.score;
+  row[ STATS_COLUMN_LINES ] = stats.lines;
+  row[ STATS_COLUMN_LEVEL ] = stats.level;
+  row[ STATS_COLUMN_STEPS ] = stats.steps;
+  row[ STATS_COLUMN_PIECES ] = stats.pieces;
+  row[ STATS_COLUMN_KEYS ] = stats.keys;
+  row[ STATS_COLUMN_HOLDS ] = stats.holds;
+  row[ STATS_COLUMN_SINGLES ] = stats.clears[ 0 ];
+  row[ STATS_COLUMN_DOUBLES ] = stats.clears[ 1 ];
+  row[ STATS_COLUMN_TRIPLES ] = stats.clears[ 2 ];
+  row[ STATS_COLUMN_TETRISES ] = stats.clears[ 3 ];
+  for( int i = 0; i < STATS_TRACKED_LEVELS; i++ )
+  {
+    row[ STATS_COLUMN_LEVEL_STEPS + i ] = stats.levelSteps[ i ];
+  }
+
+  bool success = true;
+  for( int i = 0; i < STATS_COLUMN_TOTAL; i++ )
+  {
+    success = gIOWorker.append( getPath( i ), &row[ i ], sizeof( Uint32 ) ) && success;
+  }
+
+  if( !success )
+  {
+    printf( "Warning: Unable to save game stats to %s!\n", mDirectory.c_str() );
+  }
+
+  mRows++;
+  return success;
+}
+
+int StatsStore::getRows()
+{
+  return mRows;
+}
+
+// One value per game for a column, mapped the first time it is asked for.
+// NULL when there are no games or the column could not be mapped.
+const Uint32* StatsStore::getColumn( StatsColumn column )
+{
+  if( mMaps[ column ] == NULL )
+  {
+    if( mRows == 0 || !mIntact[ column ] )
+    {
+      return NULL;
+    }
+
+    int fd = ::open( getPath( column ).c_str(), O_RDONLY );
+    if( fd < 0 )
+    {
+      printf( "Error: Could not open stats column %s!\n", getPath( column ).c_str() );
+      return NULL;
+    }
+
+    size_t size = sizeof( StatsColumnHeader ) + (size_t)mRows * sizeof( Uint32 );
+    void* data = mmap( NULL, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    ::close( fd );
+    if( data == MAP_FAILED )
+    {
+      printf( "Error: Could not map stats column %s!\n", getPath( column ).c_str() );
+      return NULL;
+    }
+
+    // Reports read each column once from start to end
+    madvise( data, size, MADV_SEQUENTIAL );
+
+    mMaps[ column ] = (Uint8*)data;
+    mMapSizes[ column ] = size;
+  }
+
+  return (const Uint32*)( mMaps[ column ] + sizeof( StatsColumnHeader ) );
+}
+
+// Name a column's file and reports use, such as "score" or "level03_steps"
+std::string StatsStore::getColumnName( int column )
+{
+  if( column < STATS_COLUMN_LEVEL_STEPS )
+  {
+    return COLUMN_NAMES[ column ];
+  }
+
+  char name[ 32 ];
+  snprintf( name, sizeof( name ), "level%02d_steps", column - STATS_COLUMN_LEVEL_STEPS + 1 );
+  return name;
+}
+
+// Column with a name, or -1
+int StatsStore::findColumn( std::string name )
+{
+  for( int i = 0; i < STATS_COLUMN_TOTAL; i++ )
+  {
+    if( getColumnName( i ) == name )
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+std::string StatsStore::getPath( int column )
+{
+  return mDirectory + "/" + getColumnName( column ) + ".col";
+}
@@ -0,0 +1,49 @@
+#ifndef STATSSTORE_H
+#define STATSSTORE_H
+
+#include <SDL2/SDL.h>
+#include <string>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+
+// Every finished game's statistics stored column by column, one append-only
+// file of Uint32 values per metric. A report maps only the columns it reads.
+// Rows are appended through the I/O worker one column after another, so a
+// crash can leave some columns a row longer; the shortest intact column
+// decides how many games there are, and the game trims the rest when it
+// opens them. A column added by a newer build starts with zeros for the
+// games recorded before it.
+class StatsStore
+{
+  public:
+  StatsStore();
+  ~StatsStore();
+
+  bool open( std::string directory, bool writable );
+  void close();
+
+  bool add( Stats& stats, Uint32 ended );
+
+  int getRows();
+  const Uint32* getColumn( StatsColumn column );
+
+  static std::string getColumnName( int column );
+  static int findColumn( std::string name );
+
+  private:
+  std::string getPath( int column );
+
+  static const Uint32 MAGIC = 0x31435054; // "TPC1"
+
+  std::string mDirectory;
+  bool mWritable;
+  int mRows;
+  bool mIntact[ STATS_COLUMN_TOTAL ];
+  Uint8* mMaps[ STATS_COLUMN_TOTAL ];
+  size_t mMapSizes[ STATS_COLUMN_TOTAL ];
+};
+
+extern StatsStore gStatsStore;
+
+#endif
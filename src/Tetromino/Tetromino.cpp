@@ -5,12 +5,15 @@
 #include "../constants.h"
 #include "../globals/globals.h"
 #include "../Square/Square.h"
+#include "../VoiceManager/VoiceManager.h"
 #include "Tetromino.h"
 
 // Initialize member variables
-Tetromino::Tetromino( TetrominoFlag type, Square gridSquares[], Uint32 fallDelay )
+Tetromino::Tetromino( TetrominoFlag type, Square gridSquares[], Uint32 fallDelay, ParticleSystem* particles )
 {
+  mParticles = particles;
   mRotation = 0;
+  mJustFell = false;
 
   mTimer.start();
 
@@ -138,6 +141,8 @@ bool Tetromino::fall()
 {
   bool falling = true;
 
+  mJustFell = false;
+
   int currentTime = mTimer.getTicks();
 
   if( currentTime >= mFallDelay )
@@ -171,6 +176,8 @@ bool Tetromino::fall()
       mGridPositions[ 3 ] = d;
 
       draw();
+
+      mJustFell = true;
     }
 
     mTimer.start();
@@ -184,6 +191,9 @@ void Tetromino::handleEvent( SDL_Event& e )
 {
   if( e.type == SDL_KEYDOWN )
   {
+    // Moves made by the player are never interpolated
+    mJustFell = false;
+
     // Move Tetromino to the left
     if( e.key.keysym.sym == SDLK_LEFT )
     {
@@ -212,7 +222,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 
 	draw();
 
-	Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	gVoiceManager.play( SOUND_EFFECT_MOVE );
       }
     }
 
@@ -244,7 +254,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	
 	draw();
 
-	Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	gVoiceManager.play( SOUND_EFFECT_MOVE );
       }
     }
 
@@ -282,7 +292,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 
 	    mRotation = 1;
 
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 	  }
 	  else
 	  {
@@ -311,7 +321,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 
 	      mRotation = 1;
 
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 	    }
 	    else
 	    {
@@ -340,7 +350,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 
 		mRotation = 1;
 
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 	      }
 	      else
 	      {
@@ -369,7 +379,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 
 		  mRotation = 1;
 
-		  Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		  gVoiceManager.play( SOUND_EFFECT_MOVE );
 		}
 	      }
 	    }
@@ -400,7 +410,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 
 	    mRotation = 2;
 
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 	  }
 	  else
 	  {
@@ -427,7 +437,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 
 	      mRotation = 2;
 
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 	    }
 	    else
 	    {
@@ -454,7 +464,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 
 		mRotation = 2;
 
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 	      }
 	      else
 	      {
@@ -481,7 +491,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 
 		  mRotation = 2;
 
-		  Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		  gVoiceManager.play( SOUND_EFFECT_MOVE );
 		}
 	      }
 	    }
@@ -501,7 +511,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -528,7 +538,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -555,7 +565,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -582,7 +592,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		    mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		    mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 		{
-		  Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		  gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		  erase();
 
@@ -613,7 +623,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -640,7 +650,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -667,7 +677,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -694,7 +704,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		    mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		    mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 		{
-		  Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		  gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		  erase();
 
@@ -728,7 +738,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 	    
@@ -755,7 +765,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -782,7 +792,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -812,7 +822,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -839,7 +849,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -866,7 +876,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -896,7 +906,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -923,7 +933,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -950,7 +960,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -980,7 +990,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 	   
 	    erase();
 
@@ -1007,7 +1017,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -1034,7 +1044,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -1067,7 +1077,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 	    
 	    erase();
 	    
@@ -1094,7 +1104,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -1121,7 +1131,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -1151,7 +1161,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -1178,7 +1188,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -1205,7 +1215,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -1235,7 +1245,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -1262,7 +1272,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -1289,7 +1299,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -1319,7 +1329,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -1346,7 +1356,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -1373,7 +1383,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -1392,7 +1402,7 @@ void Tetromino::handleEvent( SDL_Event& e )
       }
       if( mType == TETROMINO_O )
       {
-	Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	gVoiceManager.play( SOUND_EFFECT_MOVE );
       }
       if( mType == TETROMINO_S )
       {
@@ -1410,7 +1420,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 	    
@@ -1437,7 +1447,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -1464,7 +1474,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -1494,7 +1504,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -1521,7 +1531,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -1548,7 +1558,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -1578,7 +1588,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -1605,7 +1615,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -1632,7 +1642,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -1662,7 +1672,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -1689,7 +1699,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -1716,7 +1726,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -1749,7 +1759,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 	    
@@ -1776,7 +1786,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -1803,7 +1813,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -1833,7 +1843,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -1860,7 +1870,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -1887,7 +1897,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -1917,7 +1927,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -1944,7 +1954,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -1971,7 +1981,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -2001,7 +2011,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -2028,7 +2038,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -2055,7 +2065,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -2088,7 +2098,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 	    
@@ -2115,7 +2125,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -2142,7 +2152,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -2172,7 +2182,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -2199,7 +2209,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -2226,7 +2236,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -2256,7 +2266,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -2283,7 +2293,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -2310,7 +2320,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -2340,7 +2350,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 	
 	    erase();
 
@@ -2367,7 +2377,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -2394,7 +2404,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -2434,7 +2444,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL && 
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 	    
@@ -2461,7 +2471,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL && 
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 	     
@@ -2488,7 +2498,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL && 
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -2515,7 +2525,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		    mGridSquares[ c ].getState() != SQUARE_STATE_STILL && 
 		    mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 		{
-		  Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		  gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		  erase();
 
@@ -2546,7 +2556,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -2573,7 +2583,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -2600,7 +2610,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -2627,7 +2637,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		    mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		    mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 		{
-		  Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		  gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		  erase();
 
@@ -2658,7 +2668,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -2685,7 +2695,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -2712,7 +2722,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -2739,7 +2749,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		    mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		    mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 		{
-		  Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		  gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		  erase();
 
@@ -2770,7 +2780,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -2797,7 +2807,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -2824,7 +2834,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -2851,7 +2861,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		    mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		    mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 		{
-		  Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		  gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		  erase();
 
@@ -2885,7 +2895,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 	    
@@ -2912,7 +2922,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -2939,7 +2949,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -2969,7 +2979,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -2996,7 +3006,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -3023,7 +3033,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -3053,7 +3063,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -3080,7 +3090,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -3107,7 +3117,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -3137,7 +3147,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -3164,7 +3174,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -3191,7 +3201,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -3224,7 +3234,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 	    
@@ -3251,7 +3261,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -3278,7 +3288,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -3308,7 +3318,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -3335,7 +3345,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -3362,7 +3372,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -3392,7 +3402,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -3419,7 +3429,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -3446,7 +3456,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -3476,7 +3486,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -3503,7 +3513,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -3530,7 +3540,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -3549,7 +3559,7 @@ void Tetromino::handleEvent( SDL_Event& e )
       }
       if( mType == TETROMINO_O )
       {
-	Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	gVoiceManager.play( SOUND_EFFECT_MOVE );
       }
       if( mType == TETROMINO_S )
       {
@@ -3567,7 +3577,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 	    
@@ -3594,7 +3604,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -3621,7 +3631,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -3651,7 +3661,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -3678,7 +3688,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -3705,7 +3715,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -3735,7 +3745,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -3762,7 +3772,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -3789,7 +3799,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -3819,7 +3829,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -3846,7 +3856,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -3873,7 +3883,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -3906,7 +3916,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 	    
@@ -3933,7 +3943,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -3960,7 +3970,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -3990,7 +4000,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -4017,7 +4027,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -4044,7 +4054,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -4074,7 +4084,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -4101,7 +4111,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -4128,7 +4138,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -4158,7 +4168,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -4185,7 +4195,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -4212,7 +4222,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -4245,7 +4255,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 	    
@@ -4272,7 +4282,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -4299,7 +4309,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -4329,7 +4339,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -4356,7 +4366,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -4383,7 +4393,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -4413,7 +4423,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -4440,7 +4450,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -4467,7 +4477,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -4497,7 +4507,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 	      mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 	      mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	  {
-	    Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	    gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	    erase();
 
@@ -4524,7 +4534,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	    {
-	      Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+	      gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 	      erase();
 
@@ -4551,7 +4561,7 @@ void Tetromino::handleEvent( SDL_Event& e )
 		  mGridSquares[ c ].getState() != SQUARE_STATE_STILL &&
 		  mGridSquares[ d ].getState() != SQUARE_STATE_STILL )
 	      {
-		Mix_PlayChannel( MIX_CHANNEL_MOVE, gMoveSound, 0 );
+		gVoiceManager.play( SOUND_EFFECT_MOVE );
 
 		erase();
 
@@ -4603,7 +4613,7 @@ void Tetromino::handleEvent( SDL_Event& e )
     {
       erase();
 
-      Mix_PlayChannel( MIX_CHANNEL_HOLD, gHoldSound, 0 );
+      gVoiceManager.play( SOUND_EFFECT_HOLD );
     }
   }
 
@@ -4623,6 +4633,30 @@ TetrominoFlag Tetromino::getType()
   return mType;
 }
 
+// Access grid positions of the four blocks
+void Tetromino::getPositions( int positions[] )
+{
+  for( int i = 0; i < 4; i++ )
+  {
+    positions[ i ] = mGridPositions[ i ];
+  }
+}
+
+// Access grid positions of the ghost blocks
+void Tetromino::getGhostPositions( int positions[] )
+{
+  for( int i = 0; i < 4; i++ )
+  {
+    positions[ i ] = mGhostPositions[ i ];
+  }
+}
+
+// Check if the last logic step moved the Tetromino down a row
+bool Tetromino::justFell()
+{
+  return mJustFell;
+}
+
 // Reset member variables
 void Tetromino::clear()
 {
@@ -4637,6 +4671,7 @@ void Tetromino::clear()
   }
 
   mRotation = 0;
+  mJustFell = false;
 
   mTimer.stop();
 
@@ -4703,11 +4738,19 @@ void Tetromino::land()
 {
   if( mGridSquares != NULL )
   {
-    Mix_PlayChannel( MIX_CHANNEL_LAND, gLandSound, 0 );
+    gVoiceManager.play( SOUND_EFFECT_LAND );
 
     for( int i = 0; i < 4; i++ )
     {
       mGridSquares[ mGridPositions[ i ] ].stop();
+
+      // Puff of dust under each landed Square
+      if( mParticles != NULL )
+      {
+	float x = ( mGridPositions[ i ] % TOTAL_COLS ) + 0.5f;
+	float y = ( mGridPositions[ i ] / TOTAL_COLS ) + 1.0f;
+	mParticles->emit( x, y, mGridSquares[ mGridPositions[ i ] ].getSprite(), 2, 1.5f, 0.3f, 4 );
+      }
     }
   }
 }
@@ -5,17 +5,21 @@
 
 #include "../Square/Square.h"
 #include "../Timer/Timer.h"
+#include "../ParticleSystem/ParticleSystem.h"
 
 class Tetromino
 {
   public:
-  Tetromino( TetrominoFlag type, Square gridSquares[], Uint32 fallDelay );
+  Tetromino( TetrominoFlag type, Square gridSquares[], Uint32 fallDelay, ParticleSystem* particles = NULL );
   ~Tetromino();
 
   bool fall();
   void handleEvent( SDL_Event& e );
 
   TetrominoFlag getType();
+  void getPositions( int positions[] );
+  void getGhostPositions( int positions[] );
+  bool justFell();
 
   private:
   void clear();
@@ -25,12 +29,14 @@ class Tetromino
 
   Timer mTimer;
   Square* mGridSquares;
+  ParticleSystem* mParticles;
   TetrominoFlag mType;
   int mGridPositions[ 4 ];
   int mGhostPositions[ 4 ];
   int mRotation;
   Uint32 mFallDelay;
   Uint32 mInitialFallDelay;
+  bool mJustFell;
 };
 
 #endif
@@ -0,0 +1,147 @@
+#include <SDL2/SDL.h>
+#include <math.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <string>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "TextureCache.h"
+
+TextureCache gTextureCache;
+
+// Initialize member variables
+TextureCache::TextureCache()
+{
+  mEnabled = true;
+}
+
+// Turn the cache off to always decode from the source images
+void TextureCache::setEnabled( bool enabled )
+{
+  mEnabled = enabled;
+}
+
+bool TextureCache::isEnabled()
+{
+  return mEnabled;
+}
+
+// Cache file for a source image rasterized at a scale in a pixel format.
+// The source is read to the end and rewound for decoding.
+std::string TextureCache::getPath( SDL_RWops* source, float scale, Uint32 format )
+{
+  char name[ 64 ];
+  snprintf( name, sizeof( name ), "/%016llx-%d-%08x.tex", (unsigned long long)hash( source ), (int)lroundf( scale * 100 ), (unsigned int)format );
+
+  return std::string( TEXTURE_CACHE_DIR ) + name;
+}
+
+// Load a cached image straight into a surface ready for upload
+bool TextureCache::read( std::string path, DecodedImage& image )
+{
+  SDL_RWops* file = SDL_RWFromFile( path.c_str(), "rb" );
+  if( file == NULL )
+  {
+    return false;
+  }
+
+  TextureCacheHeader header;
+  SDL_Surface* surface = NULL;
+  if( SDL_RWread( file, &header, sizeof( header ), 1 ) == 1 && header.magic == MAGIC && header.pixelWidth > 0 && header.pixelHeight > 0 )
+  {
+    surface = SDL_CreateRGBSurfaceWithFormat( 0, header.pixelWidth, header.pixelHeight, SDL_BITSPERPIXEL( header.format ), header.format );
+  }
+
+  if( surface != NULL )
+  {
+    size_t rowSize = header.pixelWidth * SDL_BYTESPERPIXEL( header.format );
+    for( int y = 0; y < header.pixelHeight; y++ )
+    {
+      if( SDL_RWread( file, (Uint8*)surface->pixels + y * surface->pitch, rowSize, 1 ) != 1 )
+      {
+	printf( "Warning: Cached image %s is truncated, decoding again\n", path.c_str() );
+	SDL_FreeSurface( surface );
+	surface = NULL;
+	break;
+      }
+    }
+  }
+
+  SDL_RWclose( file );
+
+  if( surface == NULL )
+  {
+    return false;
+  }
+
+  image.surface = surface;
+  image.width = header.width;
+  image.height = header.height;
+  image.scale = header.scale;
+  return true;
+}
+
+// Store a decoded image, written aside first so a crash never leaves half a file
+bool TextureCache::write( std::string path, DecodedImage& image )
+{
+  mkdir( TEXTURE_CACHE_DIR, 0755 );
+
+  std::string partial = path + ".part";
+  SDL_RWops* file = SDL_RWFromFile( partial.c_str(), "wb" );
+  if( file == NULL )
+  {
+    printf( "Warning: Unable to cache image %s! SDL Error: %s\n", path.c_str(), SDL_GetError() );
+    return false;
+  }
+
+  SDL_Surface* surface = image.surface;
+
+  TextureCacheHeader header;
+  header.magic = MAGIC;
+  header.format = surface->format->format;
+  header.width = image.width;
+  header.height = image.height;
+  header.pixelWidth = surface->w;
+  header.pixelHeight = surface->h;
+  header.scale = image.scale;
+
+  bool success = SDL_RWwrite( file, &header, sizeof( header ), 1 ) == 1;
+
+  size_t rowSize = surface->w * surface->format->BytesPerPixel;
+  for( int y = 0; success && y < surface->h; y++ )
+  {
+    success = SDL_RWwrite( file, (Uint8*)surface->pixels + y * surface->pitch, rowSize, 1 ) == 1;
+  }
+
+  SDL_RWclose( file );
+
+  if( !success || rename( partial.c_str(), path.c_str() ) != 0 )
+  {
+    printf( "Warning: Unable to cache image %s!\n", path.c_str() );
+    remove( partial.c_str() );
+    return false;
+  }
+
+  return true;
+}
+
+// FNV-1a hash of everything left in a file, which is then rewound
+Uint64 TextureCache::hash( SDL_RWops* source )
+{
+  Uint64 hash = 14695981039346656037ULL;
+
+  Uint8 buffer[ 4096 ];
+  size_t count;
+  while( ( count = SDL_RWread( source, buffer, 1, sizeof( buffer ) ) ) > 0 )
+  {
+    for( size_t i = 0; i < count; i++ )
+    {
+      hash = ( hash ^ buffer[ i ] ) * 1099511628211ULL;
+    }
+  }
+
+  SDL_RWseek( source, 0, RW_SEEK_SET );
+
+  return hash;
+}
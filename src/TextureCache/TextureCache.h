@@ -0,0 +1,35 @@
+#ifndef TEXTURECACHE_H
+#define TEXTURECACHE_H
+
+#include <SDL2/SDL.h>
+#include <string>
+
+#include "../globals/globals.h"
+
+// Decoded images kept on disk in the renderer's own pixel format, with the
+// white color key already turned into alpha, so a later launch uploads
+// them without inflating the PNG or converting pixels again. Entries are
+// named by a hash of the source file's contents, so changed images miss.
+class TextureCache
+{
+  public:
+  TextureCache();
+
+  void setEnabled( bool enabled );
+  bool isEnabled();
+
+  std::string getPath( SDL_RWops* source, float scale, Uint32 format );
+  bool read( std::string path, DecodedImage& image );
+  bool write( std::string path, DecodedImage& image );
+
+  private:
+  static Uint64 hash( SDL_RWops* source );
+
+  static const Uint32 MAGIC = 0x31584554; // "TEX1"
+
+  bool mEnabled;
+};
+
+extern TextureCache gTextureCache;
+
+#endif
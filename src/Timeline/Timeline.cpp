@@ -0,0 +1,145 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "Timeline.h"
+
+// Initialize member variables
+Timeline::Timeline()
+{
+  mKeyCount = 0;
+  mTrackCount = 0;
+  mTicks = 0;
+  mFresh = true;
+}
+
+// Copy keyframes sorted by time into a new track and return its index, or -1.
+// Stepped tracks hold each value until the next keyframe, others blend linearly.
+// Looping tracks repeat every loop ticks.
+int Timeline::addTrack( const Keyframe* keys, int count, bool stepped, Uint32 loop )
+{
+  if( count < 1 || mTrackCount == MAX_TIMELINE_TRACKS || mKeyCount + count > MAX_TIMELINE_KEYS )
+  {
+    printf( "Error: Timeline is full!\n" );
+    return -1;
+  }
+
+  TimelineTrack& t = mTracks[ mTrackCount ];
+  t.first = mKeyCount;
+  t.count = count;
+  t.loop = loop;
+  t.stepped = stepped;
+  t.cursor = 0;
+  t.value = keys[ 0 ].value;
+  t.changed = true;
+
+  for( int i = 0; i < count; i++ )
+  {
+    mKeys[ mKeyCount++ ] = keys[ i ];
+  }
+
+  return mTrackCount++;
+}
+
+// Report every value as changed on the next evaluation
+void Timeline::reset()
+{
+  mFresh = true;
+}
+
+// Look up every track at the given time
+void Timeline::evaluate( Uint32 ticks )
+{
+  mTicks = ticks;
+
+  for( int i = 0; i < mTrackCount; i++ )
+  {
+    TimelineTrack& t = mTracks[ i ];
+    int value = lookup( t, ticks );
+
+    t.changed = mFresh || value != t.value;
+    t.value = value;
+  }
+
+  mFresh = false;
+}
+
+int Timeline::getValue( int track )
+{
+  return mTracks[ track ].value;
+}
+
+// Whether the value differs from the one before the last evaluation
+bool Timeline::hasChanged( int track )
+{
+  return mTracks[ track ].changed;
+}
+
+// Earliest time after the last evaluation at which any value can change
+Uint32 Timeline::getNextChange()
+{
+  Uint32 next = 0xFFFFFFFF;
+
+  for( int i = 0; i < mTrackCount; i++ )
+  {
+    TimelineTrack& t = mTracks[ i ];
+    Keyframe* keys = &mKeys[ t.first ];
+    Uint32 local = t.loop > 0 ? mTicks % t.loop : mTicks;
+    Uint32 change = 0xFFFFFFFF;
+
+    if( local < keys[ 0 ].time )
+    {
+      change = mTicks + ( keys[ 0 ].time - local );
+    }
+    else if( t.cursor + 1 < t.count )
+    {
+      // Blending values move every tick, held ones wait for the next keyframe
+      if( !t.stepped && keys[ t.cursor ].value != keys[ t.cursor + 1 ].value )
+      {
+	change = mTicks + 1;
+      }
+      else
+      {
+	change = mTicks + ( keys[ t.cursor + 1 ].time - local );
+      }
+    }
+    else if( t.loop > 0 )
+    {
+      change = mTicks + ( t.loop - local );
+    }
+
+    if( change < next )
+    {
+      next = change;
+    }
+  }
+
+  return next;
+}
+
+// Value of a track at a time, moving its cursor from where the last lookup left it
+int Timeline::lookup( TimelineTrack& t, Uint32 ticks )
+{
+  Keyframe* keys = &mKeys[ t.first ];
+  Uint32 local = t.loop > 0 ? ticks % t.loop : ticks;
+
+  if( local < keys[ t.cursor ].time )
+  {
+    t.cursor = 0;
+  }
+
+  while( t.cursor + 1 < t.count && keys[ t.cursor + 1 ].time <= local )
+  {
+    t.cursor++;
+  }
+
+  Keyframe& a = keys[ t.cursor ];
+  if( local < a.time || t.stepped || t.cursor + 1 == t.count )
+  {
+    return a.value;
+  }
+
+  Keyframe& b = keys[ t.cursor + 1 ];
+  return a.value + ( ( b.value - a.value ) * (int)( local - a.time ) / (int)( b.time - a.time ) );
+}
@@ -0,0 +1,34 @@
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <SDL2/SDL.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+
+// Keyframed alpha, frame and position values looked up from one clock
+class Timeline
+{
+  public:
+  Timeline();
+
+  int addTrack( const Keyframe* keys, int count, bool stepped = false, Uint32 loop = 0 );
+  void reset();
+  void evaluate( Uint32 ticks );
+
+  int getValue( int track );
+  bool hasChanged( int track );
+  Uint32 getNextChange();
+
+  private:
+  int lookup( TimelineTrack& t, Uint32 ticks );
+
+  Keyframe mKeys[ MAX_TIMELINE_KEYS ];
+  TimelineTrack mTracks[ MAX_TIMELINE_TRACKS ];
+  int mKeyCount;
+  int mTrackCount;
+  Uint32 mTicks;
+  bool mFresh;
+};
+
+#endif
@@ -1,7 +1,11 @@
 #include <SDL2/SDL.h>
 
+#include "../constants.h"
 #include "Timer.h"
 
+// Logic clock shared by every Timer
+Uint64 Timer::sClockSteps = 0;
+
 Timer::Timer()
 {
   mStartTicks = 0;
@@ -15,7 +19,7 @@ void Timer::start()
 {
   mStarted = true;
   mPaused = false;
-  mStartTicks = SDL_GetTicks();
+  mStartTicks = getClockTicks();
   mPauseTicks = 0;
 }
 
@@ -33,7 +37,7 @@ void Timer::pause()
   {
     mPaused = true;
 
-    mPauseTicks = SDL_GetTicks() - mStartTicks;
+    mPauseTicks = getClockTicks() - mStartTicks;
     mStartTicks = 0;
   }
 }
@@ -44,7 +48,7 @@ void Timer::unpause()
   {
     mPaused = false;
 
-    mStartTicks = SDL_GetTicks() - mPauseTicks;
+    mStartTicks = getClockTicks() - mPauseTicks;
     mPauseTicks = 0;
   }
 }
@@ -61,7 +65,7 @@ Uint32 Timer::getTicks()
     }
     else
     {
-      time = SDL_GetTicks() - mStartTicks;
+      time = getClockTicks() - mStartTicks;
     }
   }
 
@@ -74,7 +78,7 @@ Uint32 Timer::getPauseTicks()
 
   if( mStarted && mPaused )
   {
-    time = SDL_GetTicks() - mPauseTicks;
+    time = getClockTicks() - mPauseTicks;
   }
    
   return time;
@@ -89,3 +93,15 @@ bool Timer::isPaused()
 {
   return mPaused;
 }
+
+// Advance the logic clock by one fixed step
+void Timer::advanceClock()
+{
+  sClockSteps++;
+}
+
+// Milliseconds of game time, advanced only by logic steps
+Uint32 Timer::getClockTicks()
+{
+  return (Uint32)( ( sClockSteps * 1000 ) / LOGIC_TICKS_PER_SECOND );
+}
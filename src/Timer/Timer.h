@@ -19,11 +19,16 @@ class Timer
   bool isStarted();
   bool isPaused();
 
+  static void advanceClock();
+  static Uint32 getClockTicks();
+
   private:
   Uint32 mStartTicks;
   Uint32 mPauseTicks;
   bool mStarted;
   bool mPaused;
+
+  static Uint64 sClockSteps;
 };
 
 #endif
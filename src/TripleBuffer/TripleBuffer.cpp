@@ -0,0 +1,45 @@
+#include <SDL2/SDL.h>
+#include <string.h>
+
+#include "../globals/globals.h"
+#include "TripleBuffer.h"
+
+// Start with the writer, middle, and reader each owning one buffer
+TripleBuffer::TripleBuffer()
+{
+  memset( mBuffers, 0, sizeof( mBuffers ) );
+
+  for( int i = 0; i < 3; i++ )
+  {
+    mBuffers[ i ].state = GAME_STATE_NULL;
+  }
+
+  mWrite = 0;
+  SDL_AtomicSet( &mMiddle, 1 );
+  mRead = 2;
+}
+
+// Buffer the writer fills next, never seen by the reader
+FrameSnapshot* TripleBuffer::getWriteBuffer()
+{
+  return &mBuffers[ mWrite ];
+}
+
+// Swap the finished buffer into the middle slot
+void TripleBuffer::publish()
+{
+  int old = SDL_AtomicSet( &mMiddle, mWrite | FRESH_FLAG );
+  mWrite = old & INDEX_MASK;
+}
+
+// Take the newest published buffer, or keep the current one if nothing is new
+FrameSnapshot* TripleBuffer::acquireLatest()
+{
+  if( SDL_AtomicGet( &mMiddle ) & FRESH_FLAG )
+  {
+    int old = SDL_AtomicSet( &mMiddle, mRead );
+    mRead = old & INDEX_MASK;
+  }
+
+  return &mBuffers[ mRead ];
+}
@@ -0,0 +1,28 @@
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+#include <SDL2/SDL.h>
+
+#include "../globals/globals.h"
+
+// Lock-free handoff of frame snapshots from one writer to one reader
+class TripleBuffer
+{
+  public:
+  TripleBuffer();
+
+  FrameSnapshot* getWriteBuffer();
+  void publish();
+  FrameSnapshot* acquireLatest();
+
+  private:
+  static const int INDEX_MASK = 3;
+  static const int FRESH_FLAG = 4;
+
+  FrameSnapshot mBuffers[ 3 ];
+  SDL_atomic_t mMiddle;
+  int mWrite;
+  int mRead;
+};
+
+#endif
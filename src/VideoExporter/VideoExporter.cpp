@@ -0,0 +1,267 @@
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../LTexture/LTexture.h"
+#include "../textures/textures.h"
+#include "VideoExporter.h"
+
+FILE* VideoExporter::sStandardOutput = NULL;
+
+// Initialize member variables
+VideoExporter::VideoExporter()
+{
+  mFile = NULL;
+  mFormat = EXPORT_FORMAT_Y4M;
+
+  for( int i = 0; i < FRAME_BUFFERS; i++ )
+  {
+    mPixels[ i ] = NULL;
+  }
+  mPlanes = NULL;
+  mReadIndex = 0;
+  mWriteIndex = 0;
+  mFrames = 0;
+
+  mFreeBuffers = NULL;
+  mFilledBuffers = NULL;
+  mThread = NULL;
+  SDL_AtomicSet( &mStop, 0 );
+  SDL_AtomicSet( &mFailed, 0 );
+}
+
+VideoExporter::~VideoExporter()
+{
+  close();
+}
+
+// Open the output, "-" meaning standard output, and start the writer thread
+bool VideoExporter::open( std::string path, ExportFormat format )
+{
+  mFormat = format;
+
+  if( path == "-" )
+  {
+    keepStandardOutput();
+
+    if( sStandardOutput != NULL )
+    {
+      mFile = SDL_RWFromFP( sStandardOutput, SDL_TRUE );
+      sStandardOutput = NULL;
+    }
+  }
+  else
+  {
+    mFile = SDL_RWFromFile( path.c_str(), "wb" );
+  }
+
+  if( mFile == NULL )
+  {
+    printf( "Could not open video output %s! SDL Error: %s\n", path.c_str(), SDL_GetError() );
+    return false;
+  }
+
+  if( !mTarget.createBlank( SCREEN_WIDTH, SCREEN_HEIGHT ) )
+  {
+    printf( "Could not create offscreen render target!\n" );
+    return false;
+  }
+
+  for( int i = 0; i < FRAME_BUFFERS; i++ )
+  {
+    mPixels[ i ] = (Uint8*)malloc( SCREEN_WIDTH * SCREEN_HEIGHT * 4 );
+  }
+  mPlanes = (Uint8*)malloc( SCREEN_WIDTH * SCREEN_HEIGHT * 3 );
+
+  if( mFormat == EXPORT_FORMAT_Y4M )
+  {
+    char header[ 64 ];
+    int length = snprintf( header, sizeof( header ), "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n", SCREEN_WIDTH, SCREEN_HEIGHT, LOGIC_TICKS_PER_SECOND );
+    if( SDL_RWwrite( mFile, header, length, 1 ) != 1 )
+    {
+      printf( "Could not write video header! SDL Error: %s\n", SDL_GetError() );
+      return false;
+    }
+  }
+
+  mFreeBuffers = SDL_CreateSemaphore( FRAME_BUFFERS );
+  mFilledBuffers = SDL_CreateSemaphore( 0 );
+  mThread = SDL_CreateThread( run, "VideoExporter", this );
+  if( mThread == NULL )
+  {
+    printf( "Could not create video writer thread! SDL Error: %s\n", SDL_GetError() );
+    return false;
+  }
+
+  return true;
+}
+
+// Keep the real standard output for frames and send every message printed
+// from here on to standard error
+void VideoExporter::keepStandardOutput()
+{
+  if( sStandardOutput != NULL )
+  {
+    return;
+  }
+
+  fflush( stdout );
+  sStandardOutput = fdopen( dup( fileno( stdout ) ), "wb" );
+  dup2( fileno( stderr ), fileno( stdout ) );
+}
+
+// Send the following draws to the offscreen target
+void VideoExporter::beginFrame()
+{
+  mTarget.setAsRenderTarget();
+  SDL_SetRenderDrawColor( gRenderer, 0xFF, 0xFF, 0xFF, 0xFF );
+  SDL_RenderClear( gRenderer );
+}
+
+// Draw the queued frame, read it into a free buffer, and hand it to the writer
+bool VideoExporter::endFrame()
+{
+  gRenderQueue.submit();
+
+  SDL_SemWait( mFreeBuffers );
+
+  bool success = SDL_RenderReadPixels( gRenderer, NULL, SDL_PIXELFORMAT_RGBA32, mPixels[ mWriteIndex ], SCREEN_WIDTH * 4 ) == 0;
+  if( !success )
+  {
+    printf( "Could not read back frame %d! SDL Error: %s\n", mFrames, SDL_GetError() );
+    SDL_SemPost( mFreeBuffers );
+  }
+  else
+  {
+    mWriteIndex = ( mWriteIndex + 1 ) % FRAME_BUFFERS;
+    mFrames++;
+    SDL_SemPost( mFilledBuffers );
+  }
+
+  SDL_SetRenderTarget( gRenderer, NULL );
+
+  return success && SDL_AtomicGet( &mFailed ) == 0;
+}
+
+// Wait for pending frames to be written, then release everything
+bool VideoExporter::close()
+{
+  if( mThread != NULL )
+  {
+    for( int i = 0; i < FRAME_BUFFERS; i++ )
+    {
+      SDL_SemWait( mFreeBuffers );
+    }
+
+    SDL_AtomicSet( &mStop, 1 );
+    SDL_SemPost( mFilledBuffers );
+    SDL_WaitThread( mThread, NULL );
+    mThread = NULL;
+  }
+
+  if( mFreeBuffers != NULL )
+  {
+    SDL_DestroySemaphore( mFreeBuffers );
+    mFreeBuffers = NULL;
+  }
+
+  if( mFilledBuffers != NULL )
+  {
+    SDL_DestroySemaphore( mFilledBuffers );
+    mFilledBuffers = NULL;
+  }
+
+  for( int i = 0; i < FRAME_BUFFERS; i++ )
+  {
+    free( mPixels[ i ] );
+    mPixels[ i ] = NULL;
+  }
+  free( mPlanes );
+  mPlanes = NULL;
+
+  if( mFile != NULL )
+  {
+    SDL_RWclose( mFile );
+    mFile = NULL;
+  }
+
+  mTarget.free();
+
+  return SDL_AtomicGet( &mFailed ) == 0;
+}
+
+// Frames handed to the writer so far
+int VideoExporter::getFrameCount()
+{
+  return mFrames;
+}
+
+// Writer thread entry point, writing filled buffers in the order they were read
+int VideoExporter::run( void* data )
+{
+  VideoExporter* exporter = (VideoExporter*)data;
+
+  while( true )
+  {
+    SDL_SemWait( exporter->mFilledBuffers );
+
+    if( SDL_AtomicGet( &exporter->mStop ) == 1 )
+    {
+      break;
+    }
+
+    if( SDL_AtomicGet( &exporter->mFailed ) == 0 && !exporter->writeFrame( exporter->mPixels[ exporter->mReadIndex ] ) )
+    {
+      SDL_AtomicSet( &exporter->mFailed, 1 );
+    }
+
+    exporter->mReadIndex = ( exporter->mReadIndex + 1 ) % FRAME_BUFFERS;
+    SDL_SemPost( exporter->mFreeBuffers );
+  }
+
+  return 0;
+}
+
+// Write one frame, converting to planar BT.601 YUV for Y4M
+bool VideoExporter::writeFrame( Uint8* pixels )
+{
+  const int size = SCREEN_WIDTH * SCREEN_HEIGHT;
+
+  if( mFormat == EXPORT_FORMAT_RGBA )
+  {
+    if( SDL_RWwrite( mFile, pixels, size * 4, 1 ) != 1 )
+    {
+      printf( "Could not write video frame! SDL Error: %s\n", SDL_GetError() );
+      return false;
+    }
+
+    return true;
+  }
+
+  Uint8* y = mPlanes;
+  Uint8* u = mPlanes + size;
+  Uint8* v = mPlanes + ( size * 2 );
+
+  for( int i = 0; i < size; i++ )
+  {
+    int r = pixels[ i * 4 ];
+    int g = pixels[ ( i * 4 ) + 1 ];
+    int b = pixels[ ( i * 4 ) + 2 ];
+
+    y[ i ] = (Uint8)( 16 + ( ( ( 66 * r ) + ( 129 * g ) + ( 25 * b ) + 128 ) >> 8 ) );
+    u[ i ] = (Uint8)( 128 + ( ( ( -38 * r ) - ( 74 * g ) + ( 112 * b ) + 128 ) >> 8 ) );
+    v[ i ] = (Uint8)( 128 + ( ( ( 112 * r ) - ( 94 * g ) - ( 18 * b ) + 128 ) >> 8 ) );
+  }
+
+  if( SDL_RWwrite( mFile, "FRAME\n", 6, 1 ) != 1 || SDL_RWwrite( mFile, mPlanes, size * 3, 1 ) != 1 )
+  {
+    printf( "Could not write video frame! SDL Error: %s\n", SDL_GetError() );
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,53 @@
+#ifndef VIDEOEXPORTER_H
+#define VIDEOEXPORTER_H
+
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <string>
+
+#include "../constants.h"
+#include "../LTexture/LTexture.h"
+
+// Renders frames into an offscreen target and streams them as raw video,
+// writing one frame on its own thread while the next is drawn
+class VideoExporter
+{
+  public:
+  VideoExporter();
+  ~VideoExporter();
+
+  bool open( std::string path, ExportFormat format );
+  void beginFrame();
+  bool endFrame();
+  bool close();
+
+  int getFrameCount();
+
+  static void keepStandardOutput();
+
+  private:
+  static const int FRAME_BUFFERS = 2;
+
+  static int run( void* data );
+
+  static FILE* sStandardOutput;
+  bool writeFrame( Uint8* pixels );
+
+  LTexture mTarget;
+  SDL_RWops* mFile;
+  ExportFormat mFormat;
+
+  Uint8* mPixels[ FRAME_BUFFERS ];
+  Uint8* mPlanes;
+  int mReadIndex;
+  int mWriteIndex;
+  int mFrames;
+
+  SDL_sem* mFreeBuffers;
+  SDL_sem* mFilledBuffers;
+  SDL_Thread* mThread;
+  SDL_atomic_t mStop;
+  SDL_atomic_t mFailed;
+};
+
+#endif
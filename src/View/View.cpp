@@ -0,0 +1,82 @@
+#include <SDL2/SDL.h>
+#include <string.h>
+#include <string>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "../LTexture/LTexture.h"
+#include "../textures/textures.h"
+#include "../Timeline/Timeline.h"
+#include "View.h"
+
+Uint32 View::sTextGeneration = 1;
+
+// High scores the shared list text was last rendered from, and when
+Score View::sListScores[ TOTAL_SCORES ];
+Uint32 View::sListGeneration = 0;
+
+// Text textures were freed, so nothing rendered before can be reused
+void View::forgetText()
+{
+  sTextGeneration++;
+}
+
+// Snapshot ticks advanced by the time since it was published
+Uint32 View::getRenderTicks( FrameSnapshot& s, float interpolation )
+{
+  return s.ticks + (Uint32)( interpolation * 1000 / LOGIC_TICKS_PER_SECOND );
+}
+
+// Alpha of a prompt easing in and out every two seconds, sampled every 50 ms
+int View::addPulseTrack( Timeline& timeline )
+{
+  Keyframe keys[ 41 ];
+  for( int i = 0; i < 41; i++ )
+  {
+    int t = i * 50;
+    keys[ i ].time = t;
+    keys[ i ].value = 255 - ( 255 * ( t - 1000 ) * ( t - 1000 ) / 1000000 );
+  }
+
+  return timeline.addTrack( keys, 41, false, 2000 );
+}
+
+// Alpha of each high score row fading in one second after the other, then all fading out
+void View::addListTracks( Timeline& timeline, Uint32 start, int* tracks )
+{
+  for( int i = 0; i < TOTAL_SCORES; i++ )
+  {
+    Keyframe keys[] = { { start + ( 1000 * i ), 0 }, { start + ( 1000 * i ) + 1000, 255 }, { start + 9000, 255 }, { start + 10000, 0 } };
+    tracks[ i ] = timeline.addTrack( keys, 4 );
+  }
+}
+
+// Render the name and score of every high score into the list text shared by
+// the intro and score list, unless it already shows these scores
+void View::loadListText( Score* scores )
+{
+  if( sListGeneration == sTextGeneration && memcmp( sListScores, scores, sizeof( sListScores ) ) == 0 )
+  {
+    return;
+  }
+
+  SDL_Color nameColor = { 255, 255, 255 };
+  SDL_Color scoreColor = { 0, 0, 0 };
+
+  for( int i = 0; i < TOTAL_SCORES; i++ )
+  {
+    std::string name = scores[ i ].name;
+
+    if( name == "" )
+    {
+      name = " ";
+    }
+
+    gListTextTextures[ i ].loadFromRenderedText( name, nameColor );
+    std::string score = std::to_string( scores[ i ].score );
+    gListTextTextures[ i + TOTAL_SCORES ].loadFromRenderedText( score.c_str(), scoreColor );
+  }
+
+  memcpy( sListScores, scores, sizeof( sListScores ) );
+  sListGeneration = sTextGeneration;
+}
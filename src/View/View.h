@@ -0,0 +1,38 @@
+#ifndef VIEW_H
+#define VIEW_H
+
+#include <SDL2/SDL.h>
+
+#include "../globals/globals.h"
+#include "../Timeline/Timeline.h"
+
+// Draws one game state from snapshots on the render thread. While the state
+// before it is showing, prepare() may build whatever enter() would otherwise
+// build in the middle of the transition.
+class View
+{
+  public:
+  virtual ~View() {}
+
+  virtual void enter( FrameSnapshot& s ) = 0;
+  virtual void prepare( FrameSnapshot& s ) {}
+  virtual void render( FrameSnapshot& s, float interpolation ) = 0;
+
+  static void forgetText();
+
+  protected:
+  Uint32 getRenderTicks( FrameSnapshot& s, float interpolation );
+  int addPulseTrack( Timeline& timeline );
+  void addListTracks( Timeline& timeline, Uint32 start, int* tracks );
+
+  static void loadListText( Score* scores );
+
+  // Counts how often text textures were freed, text rendered earlier is gone
+  static Uint32 sTextGeneration;
+
+  private:
+  static Score sListScores[ TOTAL_SCORES ];
+  static Uint32 sListGeneration;
+};
+
+#endif
@@ -0,0 +1,139 @@
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+#include <stdio.h>
+
+#include "../constants.h"
+#include "../globals/globals.h"
+#include "VoiceManager.h"
+
+VoiceManager gVoiceManager;
+
+// Initialize member variables
+VoiceManager::VoiceManager()
+{
+  for( int i = 0; i < SOUND_EFFECT_TOTAL; i++ )
+  {
+    mPending[ i ] = false;
+  }
+
+  for( int i = 0; i < VOICE_CHANNELS; i++ )
+  {
+    mVoiceEffects[ i ] = -1;
+    mVoiceStarts[ i ] = 0;
+  }
+
+  mStarts = 0;
+}
+
+// Reserve the channel pool, once the mixer is open
+void VoiceManager::init()
+{
+  Mix_AllocateChannels( VOICE_CHANNELS );
+}
+
+// Ask for an effect to start at the end of this logic step
+void VoiceManager::play( SoundEffect effect )
+{
+  mPending[ effect ] = true;
+}
+
+// Start every effect asked for during the step, most important first.
+// Called once per logic step.
+void VoiceManager::update()
+{
+  for( int i = SOUND_EFFECT_TOTAL - 1; i >= 0; i-- )
+  {
+    if( !mPending[ i ] )
+    {
+      continue;
+    }
+    mPending[ i ] = false;
+
+    SoundEffect effect = (SoundEffect)i;
+    int channel = findVoice( effect );
+    if( channel < 0 )
+    {
+      continue;
+    }
+
+    // A chunk still loading is NULL and is refused here
+    if( Mix_PlayChannel( channel, getChunk( effect ), 0 ) >= 0 )
+    {
+      mVoiceEffects[ channel ] = effect;
+      mVoiceStarts[ channel ] = ++mStarts;
+    }
+  }
+}
+
+// Channel to start an effect on: its own oldest voice once it is at its limit,
+// then a free channel, then the oldest voice of the least important effect
+// below it. -1 when every channel is playing something at least as important.
+int VoiceManager::findVoice( SoundEffect effect )
+{
+  int count = 0;
+  int oldest = -1;
+  int free = -1;
+  int steal = -1;
+
+  for( int i = 0; i < VOICE_CHANNELS; i++ )
+  {
+    if( Mix_Playing( i ) == 0 )
+    {
+      mVoiceEffects[ i ] = -1;
+      if( free < 0 )
+      {
+	free = i;
+      }
+      continue;
+    }
+
+    int playing = mVoiceEffects[ i ];
+    if( playing == effect )
+    {
+      count++;
+      if( oldest < 0 || mVoiceStarts[ i ] < mVoiceStarts[ oldest ] )
+      {
+	oldest = i;
+      }
+    }
+    else if( playing >= 0 && SOUND_EFFECT_PRIORITIES[ playing ] < SOUND_EFFECT_PRIORITIES[ effect ] )
+    {
+      if( steal < 0 || SOUND_EFFECT_PRIORITIES[ playing ] < SOUND_EFFECT_PRIORITIES[ mVoiceEffects[ steal ] ]
+	  || ( SOUND_EFFECT_PRIORITIES[ playing ] == SOUND_EFFECT_PRIORITIES[ mVoiceEffects[ steal ] ] && mVoiceStarts[ i ] < mVoiceStarts[ steal ] ) )
+      {
+	steal = i;
+      }
+    }
+  }
+
+  if( count >= SOUND_EFFECT_VOICE_LIMITS[ effect ] )
+  {
+    return oldest;
+  }
+
+  return free >= 0 ? free : steal;
+}
+
+Mix_Chunk* VoiceManager::getChunk( SoundEffect effect )
+{
+  switch( effect )
+  {
+    case SOUND_EFFECT_MOVE:
+      return gMoveSound;
+
+    case SOUND_EFFECT_HOLD:
+      return gHoldSound;
+
+    case SOUND_EFFECT_LAND:
+      return gLandSound;
+
+    case SOUND_EFFECT_CLEAR:
+      return gClearSound;
+
+    case SOUND_EFFECT_TETRIS:
+      return gTetrisSound;
+
+    default:
+      return NULL;
+  }
+}
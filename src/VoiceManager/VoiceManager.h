@@ -0,0 +1,35 @@
+#ifndef VOICEMANAGER_H
+#define VOICEMANAGER_H
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_mixer.h>
+
+#include "../constants.h"
+
+// Plays sound effects on a fixed pool of mixer channels. Effects asked for
+// during a logic step are started together at its end, once each, and busy
+// voices are reused by effect priority.
+class VoiceManager
+{
+  public:
+  VoiceManager();
+
+  void init();
+  void play( SoundEffect effect );
+  void update();
+
+  private:
+  int findVoice( SoundEffect effect );
+  Mix_Chunk* getChunk( SoundEffect effect );
+
+  bool mPending[ SOUND_EFFECT_TOTAL ];
+
+  // Effect last started on each channel and when, counted in voices started
+  int mVoiceEffects[ VOICE_CHANNELS ];
+  Uint32 mVoiceStarts[ VOICE_CHANNELS ];
+  Uint32 mStarts;
+};
+
+extern VoiceManager gVoiceManager;
+
+#endif
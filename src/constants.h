@@ -10,6 +10,92 @@ const int TOTAL_ROWS = 20;
 const int TOTAL_COLS = 10;
 const int TOTAL_SQUARES = TOTAL_ROWS * TOTAL_COLS;
 
+// Fixed logic update rate and frame pacing limits
+const int LOGIC_TICKS_PER_SECOND = 60;
+const int MAX_LOGIC_STEPS_PER_FRAME = 5;
+const int DEFAULT_FPS_CAP = 60;
+const int FRAME_TIME_SAMPLES = 60;
+
+// Upcoming Tetrominoes shown beside the grid
+const int NEXT_QUEUE_SIZE = 3;
+
+// Input events waiting for the simulation thread
+const int INPUT_QUEUE_SIZE = 256;
+
+// Particle pool size and the pull of gravity in rows per second squared
+const int PARTICLE_CAPACITY = 1024;
+const float PARTICLE_GRAVITY = 40.0f;
+
+// Spectator minimaps: how many can be shown, atlas layout, and how often
+// boards out of focus are refreshed
+const int MAX_MINIMAPS = 99;
+const int MINIMAP_ATLAS_COLS = 10;
+const int MINIMAP_ROWS = TOTAL_ROWS - 2;
+const int MINIMAP_UNFOCUSED_INTERVAL = 4;
+
+// Dirty rect rendering: screen tiles compared between frames, and the share
+// of tiles that may change before the whole screen is redrawn instead
+const int DIRTY_TILE_SIZE = 25;
+const int DIRTY_TILE_COLS = ( SCREEN_WIDTH + DIRTY_TILE_SIZE - 1 ) / DIRTY_TILE_SIZE;
+const int DIRTY_TILE_ROWS = ( SCREEN_HEIGHT + DIRTY_TILE_SIZE - 1 ) / DIRTY_TILE_SIZE;
+const int DIRTY_TILES = DIRTY_TILE_COLS * DIRTY_TILE_ROWS;
+const int DIRTY_FULL_REDRAW_PERCENT = 50;
+
+// Audio buffer in sample frames, and how many late mixer callbacks within a
+// window of logic steps make the buffer grow
+const int AUDIO_BUFFER_SAMPLES = 512;
+const int AUDIO_MAX_BUFFER_SAMPLES = 4096;
+const int AUDIO_UNDERRUN_LIMIT = 3;
+const int AUDIO_UNDERRUN_WINDOW = 600;
+
+// Most worker threads images are decoded on at startup
+const int MAX_DECODE_THREADS = 8;
+
+// Every finished game's score: a sorted snapshot, the journal of scores added
+// since, how many journal records trigger a new snapshot, and how many scores
+// are kept before the lowest are dropped
+const char SCORE_SNAPSHOT_PATH[] = "bin/scores.bin";
+const char SCORE_JOURNAL_PATH[] = "bin/scores.journal";
+const int SCORE_COMPACT_RECORDS = 256;
+const int SCORE_STORE_CAPACITY = 131072;
+
+// Writes waiting for the persistence thread before producers have to wait,
+// and the longest file path a write can name
+const int IO_QUEUE_SIZE = 64;
+const int IO_PATH_LENGTH = 256;
+
+// Every finished game's statistics, one file per column under this
+// directory, and how many levels get a column of their own for the time
+// spent in them, the last one also counting every level above it
+const char STATS_DIR[] = "bin/stats";
+const int STATS_TRACKED_LEVELS = 15;
+
+// Settings kept between launches
+const char CONFIG_PATH[] = "bin/tetpnc.cfg";
+
+// Archive holding every asset file, built by the tetpnc-pack step, and the
+// longest path stored in it
+const char ASSET_PACK_PATH[] = "bin/assets.pak";
+const int ASSET_NAME_LENGTH = 64;
+
+// Images already rasterized in the renderer's pixel format, named by a hash
+// of the source file, the output scale, and the format
+const char TEXTURE_CACHE_DIR[] = "bin/cache";
+
+// Where --profile-startup writes its phase timings, and the longest phase name kept
+const char STARTUP_PROFILE_PATH[] = "bin/startup_profile.json";
+const int STARTUP_PHASE_NAME_LENGTH = 96;
+
+// Where the last finished game is recorded for replays and video export
+const char RECORDING_PATH[] = "bin/last_game.tpr";
+
+// Animated values and keyframes one Timeline can hold
+const int MAX_TIMELINE_TRACKS = 16;
+const int MAX_TIMELINE_KEYS = 128;
+
+// Draw commands recorded per frame before the queue is flushed early
+const int RENDER_QUEUE_SIZE = 1024;
+
 // Score, music, and background image count
 const int TOTAL_SCORES = 5;
 const int TOTAL_BGM = 3;
@@ -29,6 +115,24 @@ enum TetrominoFlag
   TETROMINO_COUNT
 };
 
+// Preview layout of a Tetromino: width of its two row grid and the cells it fills
+struct PreviewShape
+{
+  int width;
+  int cells[ 4 ];
+};
+
+constexpr PreviewShape PREVIEW_SHAPES[ TETROMINO_NULL ] =
+{
+  { 4, { 4, 5, 6, 7 } }, // I
+  { 3, { 0, 3, 4, 5 } }, // J
+  { 3, { 2, 3, 4, 5 } }, // L
+  { 4, { 1, 2, 5, 6 } }, // O
+  { 3, { 1, 2, 3, 4 } }, // S
+  { 3, { 1, 3, 4, 5 } }, // T
+  { 3, { 0, 1, 4, 5 } }  // Z
+};
+
 // Square states
 enum SquareState
 {
@@ -63,16 +167,123 @@ enum GameStateFlag
   GAME_STATE_ERROR
 };
 
-// Mix Channels
-enum MixChannels
+// State each one normally hands over to, got ready while it is still showing
+constexpr GameStateFlag EXPECTED_NEXT_STATES[ GAME_STATE_ERROR ] =
 {
-  MIX_CHANNEL_MUSIC,
-  MIX_CHANNEL_MOVE,
-  MIX_CHANNEL_HOLD,
-  MIX_CHANNEL_LAND,
-  MIX_CHANNEL_CLEAR,
-  MIX_CHANNEL_TETRIS,
-  MIX_CHANNEL_GAMEOVER
+  GAME_STATE_NULL,
+  GAME_STATE_PLAY,
+  GAME_STATE_GAMEOVER,
+  GAME_STATE_SCORELIST,
+  GAME_STATE_INTRO
 };
 
+// Frame pacing modes
+enum PacingMode
+{
+  PACING_MODE_VSYNC,
+  PACING_MODE_CAPPED,
+  PACING_MODE_UNCAPPED
+};
+
+// Draw order layers, submitted back to front
+enum RenderLayer
+{
+  RENDER_LAYER_BACKGROUND,
+  RENDER_LAYER_SHADE,
+  RENDER_LAYER_DECORATION,
+  RENDER_LAYER_FRAME,
+  RENDER_LAYER_FLASH,
+  RENDER_LAYER_SQUARES,
+  RENDER_LAYER_PARTICLES,
+  RENDER_LAYER_TEXT,
+  RENDER_LAYER_PROMPT,
+  RENDER_LAYER_PANEL,
+  RENDER_LAYER_LABEL,
+  RENDER_LAYER_MINIMAP,
+  RENDER_LAYER_OVERLAY,
+  RENDER_LAYER_DEBUG,
+  RENDER_LAYER_TOTAL
+};
+
+// Where recorded draw commands are submitted
+enum RenderBackend
+{
+  RENDER_BACKEND_SDL,
+  RENDER_BACKEND_NULL
+};
+
+// Raw video formats written when exporting a recorded game
+enum ExportFormat
+{
+  EXPORT_FORMAT_Y4M,
+  EXPORT_FORMAT_RGBA
+};
+
+// How a queued write reaches its file
+enum IOJobType
+{
+  IO_JOB_APPEND,
+  IO_JOB_REPLACE
+};
+
+// Columns of the per-game statistics, each one value per finished game
+enum StatsColumn
+{
+  STATS_COLUMN_ENDED,
+  STATS_COLUMN_SCORE,
+  STATS_COLUMN_LINES,
+  STATS_COLUMN_LEVEL,
+  STATS_COLUMN_STEPS,
+  STATS_COLUMN_PIECES,
+  STATS_COLUMN_KEYS,
+  STATS_COLUMN_HOLDS,
+  STATS_COLUMN_SINGLES,
+  STATS_COLUMN_DOUBLES,
+  STATS_COLUMN_TRIPLES,
+  STATS_COLUMN_TETRISES,
+  STATS_COLUMN_LEVEL_STEPS,
+  STATS_COLUMN_TOTAL = STATS_COLUMN_LEVEL_STEPS + STATS_TRACKED_LEVELS
+};
+
+// Sounds and music in the order they are loaded in the background
+enum AudioAsset
+{
+  AUDIO_ASSET_START_MUSIC,
+  AUDIO_ASSET_MOVE,
+  AUDIO_ASSET_HOLD,
+  AUDIO_ASSET_LAND,
+  AUDIO_ASSET_CLEAR,
+  AUDIO_ASSET_TETRIS,
+  AUDIO_ASSET_SCORE_MUSIC,
+  AUDIO_ASSET_GAMEOVER_MUSIC,
+  AUDIO_ASSET_BGM,
+  AUDIO_ASSET_TOTAL = AUDIO_ASSET_BGM + TOTAL_BGM
+};
+
+// Progress of one background audio load
+enum AudioLoadState
+{
+  AUDIO_LOAD_PENDING,
+  AUDIO_LOAD_READY,
+  AUDIO_LOAD_FAILED
+};
+
+// Sound effects, from least to most important
+enum SoundEffect
+{
+  SOUND_EFFECT_MOVE,
+  SOUND_EFFECT_HOLD,
+  SOUND_EFFECT_LAND,
+  SOUND_EFFECT_CLEAR,
+  SOUND_EFFECT_TETRIS,
+  SOUND_EFFECT_TOTAL
+};
+
+// Mixer channels shared by every sound effect, music plays on its own stream
+const int VOICE_CHANNELS = 8;
+
+// Which effects may take a busy channel from which, and how many channels each may hold
+constexpr int SOUND_EFFECT_PRIORITIES[ SOUND_EFFECT_TOTAL ] = { 0, 1, 1, 2, 3 };
+constexpr int SOUND_EFFECT_VOICE_LIMITS[ SOUND_EFFECT_TOTAL ] = { 2, 1, 2, 1, 1 };
+
 #endif
@@ -6,18 +6,16 @@
 #include "../constants.h"
 #include "globals.h"
 
-// High scores
-Score gScores[ TOTAL_SCORES ];
-
 // SDL objects for rendering
 SDL_Window* gWindow = NULL;
 SDL_Surface* gScreenSurface = NULL;
 SDL_Renderer* gRenderer = NULL;
 TTF_Font* gFont = NULL; // Font
 
-// Menu music
-Mix_Chunk* gStartMusic = NULL;
-Mix_Chunk* gScoreMusic = NULL;
+// Menu and game over music, streamed from disk
+Mix_Music* gStartMusic = NULL;
+Mix_Music* gScoreMusic = NULL;
+Mix_Music* gGameOverMusic = NULL;
 
 // Sound effects
 Mix_Chunk* gMoveSound = NULL;
@@ -25,7 +23,6 @@ Mix_Chunk* gHoldSound = NULL;
 Mix_Chunk* gLandSound = NULL;
 Mix_Chunk* gClearSound = NULL;
 Mix_Chunk* gTetrisSound = NULL;
-Mix_Chunk* gGameOverSound = NULL;
 
-// Background music
-Mix_Chunk* gBGMusic[ TOTAL_BGM ];
+// Background music, streamed from disk
+Mix_Music* gBGMusic[ TOTAL_BGM ];
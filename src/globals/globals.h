@@ -14,30 +14,215 @@ struct Score
   int score;
 };
 
-// High scores
-extern Score gScores[ TOTAL_SCORES ];
+// Start of the score snapshot and journal files. The snapshot's count and
+// checksum cover the scores after it; the journal's records carry their own.
+struct ScoreFileHeader
+{
+  Uint32 magic;
+  Uint32 generation;
+  Uint32 count;
+  Uint32 checksum;
+};
+
+// One score appended to the journal
+struct ScoreRecord
+{
+  Score score;
+  Uint32 checksum;
+};
 
 // Game stats
 struct Stats
 {
-  TetrominoFlag nextTetrominoes[ 3 ];
+  TetrominoFlag nextTetrominoes[ NEXT_QUEUE_SIZE ];
   TetrominoFlag holdTetromino;
   int score;
   int lines;
   int level;
   int currentBG;
   int currentBGM;
+
+  // Counted for the stats store: pieces locked, keys pressed, lines
+  // cleared at once from one to four, and logic steps played in total
+  // and on each level
+  int pieces;
+  int keys;
+  int holds;
+  int clears[ 4 ];
+  Uint32 steps;
+  Uint32 levelSteps[ STATS_TRACKED_LEVELS ];
 };  
 
+// Value a timeline track reaches at a time, in ticks from the start of the animation
+struct Keyframe
+{
+  Uint32 time;
+  int value;
+};
+
+// Keyframes of one animated value and where the last lookup left off
+struct TimelineTrack
+{
+  int first;
+  int count;
+  Uint32 loop;
+  bool stepped;
+  int cursor;
+  int value;
+  bool changed;
+};
+
+// Where one asset file lies in the asset pack
+struct PackEntry
+{
+  char name[ ASSET_NAME_LENGTH ];
+  Uint32 offset;
+  Uint32 size;
+};
+
+// Image read and rasterized off the render thread, waiting to become a texture
+struct DecodedImage
+{
+  SDL_Surface* surface;
+  int width;
+  int height;
+  float scale;
+  Uint64 decodeStart;
+  Uint64 decodeTime;
+};
+
+// Start of a cached image file, followed by its rows of pixels
+struct TextureCacheHeader
+{
+  Uint32 magic;
+  Uint32 format;
+  Sint32 width;
+  Sint32 height;
+  Sint32 pixelWidth;
+  Sint32 pixelHeight;
+  float scale;
+};
+
+// One timed step of startup, in performance counter ticks since the process began
+struct StartupPhase
+{
+  char name[ STARTUP_PHASE_NAME_LENGTH ];
+  Uint64 start;
+  Uint64 duration;
+};
+
+// Bytes handed to the persistence thread, owned by the job until written.
+// A job with a file named in after is skipped unless that file's last write succeeded.
+struct IOJob
+{
+  IOJobType type;
+  char path[ IO_PATH_LENGTH ];
+  char after[ IO_PATH_LENGTH ];
+  Uint8* data;
+  size_t size;
+  Uint64 queued;
+};
+
+// Start of one stats column file, followed by a Uint32 per finished game
+struct StatsColumnHeader
+{
+  Uint32 magic;
+  Uint32 column;
+};
+
+// Input handled by the simulation on one logic step of a recorded game
+struct RecordedEvent
+{
+  Uint32 step;
+  SDL_Event event;
+};
+
+// What to replay and where to stream it when exporting video
+struct ExportOptions
+{
+  bool enabled;
+  const char* recording;
+  const char* output;
+  ExportFormat format;
+};
+
+// Live particles stored as parallel arrays, positions in grid cells
+struct ParticleBuffer
+{
+  int count;
+  int dropped;
+  float updateTime;
+  float x[ PARTICLE_CAPACITY ];
+  float y[ PARTICLE_CAPACITY ];
+  float vx[ PARTICLE_CAPACITY ];
+  float vy[ PARTICLE_CAPACITY ];
+  Uint8 sprite[ PARTICLE_CAPACITY ];
+  Uint8 alpha[ PARTICLE_CAPACITY ];
+  Uint8 size[ PARTICLE_CAPACITY ];
+};
+
+// Everything needed to draw one frame, published by the simulation thread
+struct FrameSnapshot
+{
+  GameStateFlag state;
+  int stateSerial;
+  Uint64 publishTime;
+  Uint32 ticks;
+  Uint32 pauseTicks;
+
+  // Grid contents
+  Uint8 squareStates[ TOTAL_SQUARES ];
+  Uint8 squareSprites[ TOTAL_SQUARES ];
+  Uint8 squareAlphas[ TOTAL_SQUARES ];
+
+  // Falling Tetromino and its ghost
+  int piecePositions[ 4 ];
+  int ghostPositions[ 4 ];
+  bool pieceFell;
+
+  // Ticks into the game over screen at which each Square disappears
+  Uint16 clearTimes[ TOTAL_SQUARES ];
+
+  // Line clear and landing effects
+  ParticleBuffer particles;
+
+  // Game progress
+  Stats stats;
+  bool started;
+  bool paused;
+  bool clearing;
+  bool tetris;
+
+  // High scores and name entry
+  Score scores[ TOTAL_SCORES ];
+  char name[ 11 ];
+  int newScore;
+  int newRank;
+  bool gotHighScore;
+};
+
+// One recorded texture copy
+struct RenderCommand
+{
+  SDL_Texture* texture;
+  SDL_Rect clip;
+  SDL_Rect quad;
+  Uint16 order;
+  Uint8 alpha;
+  Uint8 layer;
+  bool clipped;
+};
+
 // SDL objects for rendering
 extern SDL_Window* gWindow;
 extern SDL_Surface* gScreenSurface;
 extern SDL_Renderer* gRenderer;
 extern TTF_Font* gFont; // Font
 
-// Menu music
-extern Mix_Chunk* gStartMusic;
-extern Mix_Chunk* gScoreMusic;
+// Menu and game over music, streamed from disk
+extern Mix_Music* gStartMusic;
+extern Mix_Music* gScoreMusic;
+extern Mix_Music* gGameOverMusic;
 
 // Sound effects
 extern Mix_Chunk* gMoveSound;
@@ -45,9 +230,8 @@ extern Mix_Chunk* gHoldSound;
 extern Mix_Chunk* gLandSound;
 extern Mix_Chunk* gClearSound;
 extern Mix_Chunk* gTetrisSound;
-extern Mix_Chunk* gGameOverSound;
 
-// Background music
-extern Mix_Chunk* gBGMusic[ TOTAL_BGM ];
+// Background music, streamed from disk
+extern Mix_Music* gBGMusic[ TOTAL_BGM ];
 
 #endif
@@ -2,34 +2,87 @@
 #include <SDL2/SDL_image.h>
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_mixer.h>
+#include <math.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string>
 #include <time.h>
+#include <vector>
 
 #include "constants.h"
 #include "globals/globals.h"
 #include "LTexture/LTexture.h"
 #include "textures/textures.h"
 #include "Square/Square.h"
-#include "GameState/GameState.h"
-#include "Intro/Intro.h"
-#include "Play/Play.h"
-#include "GameOver/GameOver.h"
-#include "ScoreList/ScoreList.h"
+#include "FramePacer/FramePacer.h"
+#include "Minimap/Minimap.h"
+#include "Config/Config.h"
+#include "AssetPack/AssetPack.h"
+#include "DecodePool/DecodePool.h"
+#include "TextureCache/TextureCache.h"
+#include "StartupProfiler/StartupProfiler.h"
+#include "IOWorker/IOWorker.h"
+#include "ScoreStore/ScoreStore.h"
+#include "StatsStore/StatsStore.h"
+#include "AudioDevice/AudioDevice.h"
+#include "AudioLoader/AudioLoader.h"
+#include "MusicController/MusicController.h"
+#include "VoiceManager/VoiceManager.h"
+#include "RendererBenchmark/RendererBenchmark.h"
+#include "Timer/Timer.h"
+#include "Recording/Recording.h"
+#include "VideoExporter/VideoExporter.h"
+#include "TripleBuffer/TripleBuffer.h"
+#include "InputQueue/InputQueue.h"
+#include "Simulation/Simulation.h"
+#include "View/View.h"
+#include "IntroView/IntroView.h"
+#include "PlayView/PlayView.h"
+#include "GameOverView/GameOverView.h"
+#include "ScoreListView/ScoreListView.h"
+
+// Output pixels per screen pixel once the screen is fitted to the window
+float getOutputScale()
+{
+  int width = SCREEN_WIDTH;
+  int height = SCREEN_HEIGHT;
+  SDL_GetRendererOutputSize( gRenderer, &width, &height );
+
+  float scale = fminf( (float)width / SCREEN_WIDTH, (float)height / SCREEN_HEIGHT );
+
+  return scale > 0.0f ? scale : 1.0f;
+}
 
-bool init()
+// Without audio, as when only filling the texture cache, no sound device is needed
+bool init( PacingMode pacing, bool hidden, bool audio, Config& config, bool calibrate )
 {
   bool success = true;
   
-  if( SDL_Init( SDL_INIT_VIDEO | SDL_INIT_AUDIO ) < 0 )
+  Uint64 phase = gStartupProfiler.begin();
+  bool initialized = SDL_Init( audio ? SDL_INIT_VIDEO | SDL_INIT_AUDIO : SDL_INIT_VIDEO ) >= 0;
+  gStartupProfiler.end( "SDL_Init", phase );
+
+  if( !initialized )
   {
     printf( "SDL could not initialize! SDL Error: %s\n", SDL_GetError() );
     success = false;
   }
   else
   {
-    gWindow = SDL_CreateWindow( "TETPNC", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, SCREEN_WIDTH, SCREEN_HEIGHT, SDL_WINDOW_SHOWN );
+    Uint32 windowFlags = SDL_WINDOW_HIDDEN;
+    if( !hidden )
+    {
+      windowFlags = SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE;
+      if( config.getInt( "fullscreen", 0 ) == 1 )
+      {
+	windowFlags |= SDL_WINDOW_FULLSCREEN_DESKTOP;
+      }
+    }
+
+    phase = gStartupProfiler.begin();
+    gWindow = SDL_CreateWindow( "TETPNC", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, SCREEN_WIDTH, SCREEN_HEIGHT, windowFlags );
+    gStartupProfiler.end( "window", phase );
+
     if( gWindow == NULL )
     {
       printf( "SDL could not create window! SDL Error: %s\n", SDL_GetError() );
@@ -37,7 +90,50 @@ bool init()
     }
     else
     {
-      gRenderer = SDL_CreateRenderer( gWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC );
+      Uint32 rendererFlags = SDL_RENDERER_ACCELERATED | SDL_RENDERER_TARGETTEXTURE;
+      if( pacing == PACING_MODE_VSYNC )
+      {
+	rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+      }
+
+      // Use the driver measured fastest on this machine, measuring on the first
+      // launch that shows a window. Timings on a hidden window say little about
+      // the kiosk, and exports must not print them ahead of their video.
+      RendererBenchmark benchmark;
+      int driver = -1;
+      if( gRenderQueue.getDirtyTracking() )
+      {
+	// Redrawing only what changed relies on the software renderer keeping the last frame
+	driver = benchmark.findDriver( "software" );
+      }
+      else if( !hidden && ( calibrate || !config.has( "renderer" ) ) )
+      {
+	phase = gStartupProfiler.begin();
+	driver = benchmark.pickFastest( gWindow, rendererFlags );
+	gStartupProfiler.end( "renderer calibration", phase );
+
+	// Without a winner the next launch measures again
+	if( driver != -1 )
+	{
+	  config.setString( "renderer", benchmark.getDriverName( driver ) );
+	  config.save();
+	}
+      }
+      else
+      {
+	driver = benchmark.findDriver( config.getString( "renderer", "" ) );
+      }
+
+      // A chosen driver may be the software one
+      if( driver != -1 )
+      {
+	rendererFlags &= ~SDL_RENDERER_ACCELERATED;
+      }
+
+      phase = gStartupProfiler.begin();
+      gRenderer = SDL_CreateRenderer( gWindow, driver, rendererFlags );
+      gStartupProfiler.end( "renderer", phase );
+
       if( gRenderer == NULL )
       {
 	printf( "Renderer could not be created! SDL Error: %s\n", SDL_GetError() );
@@ -45,28 +141,65 @@ bool init()
       }
       else
       {
+	// Only the software renderer draws into the window surface that dirty rects are copied from
+	SDL_RendererInfo info;
+	if( gRenderQueue.getDirtyTracking() && ( SDL_GetRendererInfo( gRenderer, &info ) != 0 || !( info.flags & SDL_RENDERER_SOFTWARE ) ) )
+	{
+	  printf( "Software renderer unavailable, redrawing the whole screen instead of dirty rects\n" );
+	  gRenderQueue.setDirtyTracking( false );
+	}
+
 	SDL_SetRenderDrawColor( gRenderer, 0xFF, 0xFF, 0xFF, 0xFF );
+
+	// Layout stays in screen pixels, letterboxed into whatever size the window has
+	SDL_RenderSetLogicalSize( gRenderer, SCREEN_WIDTH, SCREEN_HEIGHT );
+	LTexture::setScale( getOutputScale() );
 	
+	phase = gStartupProfiler.begin();
 	int imgFlags = IMG_INIT_PNG;
-	if( !( IMG_Init( imgFlags ) & imgFlags ) )
+	bool imageReady = ( IMG_Init( imgFlags ) & imgFlags ) != 0;
+	gStartupProfiler.end( "IMG_Init", phase );
+
+	if( !imageReady )
 	{
 	  printf( "SDL_image could not initialize! SDL_image Error: %s\n", IMG_GetError() );
 	  success = false;
 	}
 	else
 	{
-	  if( TTF_Init() == -1 )
+	  phase = gStartupProfiler.begin();
+	  bool fontReady = TTF_Init() != -1;
+	  gStartupProfiler.end( "TTF_Init", phase );
+
+	  if( !fontReady )
 	  {
 	    printf( "SDL_ttf could not initialize! SDL_ttf Error: %s\n", TTF_GetError() );
 	    success = false;
 	  }
-	  else
+	  else if( audio )
 	  {
-	    if( Mix_OpenAudio( 44100, MIX_DEFAULT_FORMAT, 2, 4096 ) < 0 )
+	    phase = gStartupProfiler.begin();
+	    bool audioReady = gAudioDevice.open( config.getInt( "audio_buffer", AUDIO_BUFFER_SAMPLES ) );
+	    gStartupProfiler.end( "audio device open", phase );
+
+	    if( !audioReady )
 	    {
-	      printf( "SDL_mixer could not initializae! SDL_mixer Error: %s\n", Mix_GetError() );
 	      success = false;
 	    }
+	    else
+	    {
+	      gMusicController.init();
+	      gVoiceManager.init();
+
+	      // Music falls back to WAV files without Ogg Vorbis support
+	      phase = gStartupProfiler.begin();
+	      int mixFlags = MIX_INIT_OGG;
+	      if( !( Mix_Init( mixFlags ) & mixFlags ) )
+	      {
+		printf( "Warning: Ogg Vorbis music not supported! SDL_mixer Error: %s\n", Mix_GetError() );
+	      }
+	      gStartupProfiler.end( "Mix_Init", phase );
+	    }
 	  }
 	}
       }
@@ -76,263 +209,131 @@ bool init()
   return success;
 }
 
-bool loadMedia()
+// Load images and the font, rasterized at the current output scale. Images are
+// decoded on the decode pool and only uploaded here, in the order they finish.
+bool loadScaledMedia()
 {
   bool success = true;
 
-  SDL_RWops* file = SDL_RWFromFile( "bin/scores.bin", "r+b" );
-  if( file == NULL )
-  {
-    file = SDL_RWFromFile( "bin/scores.bin", "w+b" );
-    if( file != NULL )
-    {
-      for( int i = 0; i < TOTAL_SCORES; i++ )
-      {
-	std::string name = "TAKASHI";
-	strcpy( gScores[ i ].name, name.c_str() );
-	gScores[ i ].score = 500 - ( i * 100 );
-	SDL_RWwrite( file, &gScores[ i ], sizeof( Score ), 1 );
-      }
-
-      SDL_RWclose( file );
-    }
-    else
-    {
-      printf( "Error: Unable to create file! SDL Error: %s\n", SDL_GetError() );
-      success = false;
-    }
-  }
-  else
-  {
-    for( int i = 0; i < TOTAL_SCORES; i++ )
-    {
-      SDL_RWread( file, &gScores[ i ], sizeof( Score ), 1 );
-    }
-
-    SDL_RWclose( file );
-  }
-
-  if( !gBlankBGTexture.loadFromFile( "images/blank_bg.png" ) )
-  {
-    printf( "Failed to load blank background texture!\n" );
-    success = false;
-  }
-
-  if( !gPressEnterTexture.loadFromFile( "images/press_enter.png" ) )
-  {
-    printf( "Failed to load press enter prompt texture!\n" );
-    success = false;
-  }
-
-  if( !gPlayBGTexture.loadFromFile( "images/play_bg.png" ) )
-  {
-    printf( "Failed to load play background texture!\n" );
-    success = false;
-  }
-
-  if( !gPausedTexture.loadFromFile( "images/paused.png" ) )
-  {
-    printf( "Failed to load pause prompt texture!\n" );
-    success = false;
-  }
-
-  if( !gGameOverTexture.loadFromFile( "images/game_over.png" ) )
-  {
-    printf( "Failed to load game over prompt texture!\n" );
-    success = false;
-  }
-
-  if( !gEnterNameTexture.loadFromFile( "images/enter_name.png" ) )
-  {
-    printf( "Failed to load enter name prompt texture!\n" );
-    success = false;
-  }
-
-  if( !gBlackTexture.loadFromFile( "images/black.png" ) )
-  {
-    printf( "Failed to load black texture!\n" );
-    success = false;
-  }
+  LTexture* screenTextures[] = { &gBlankBGTexture, &gPressEnterTexture, &gPlayBGTexture, &gPausedTexture, &gGameOverTexture, &gEnterNameTexture,
+				 &gBlackTexture, &gTetrisTexture, &gListTexture, &gSquareSpriteTexture, &gHandBlackTexture, &gHandWhiteTexture };
+  const char* screenPaths[] = { "images/blank_bg.png", "images/press_enter.png", "images/play_bg.png", "images/paused.png", "images/game_over.png",
+				"images/enter_name.png", "images/black.png", "images/tetpnc.png", "images/scores.png", "images/blocks.png",
+				"images/hands1.png", "images/hands2.png" };
 
-  if( !gTetrisTexture.loadFromFile( "images/tetpnc.png" ) )
-  {
-    printf( "Failed to load tetpnc texture!\n" );
-    success = false;
-  }
+  // Texture each decode job is uploaded into
+  std::vector<LTexture*> textures;
 
-  if( !gListTexture.loadFromFile( "images/scores.png" ) )
-  {
-    printf( "Failed to load score list texture!\n" );
-    success = false;
-  }
-  else
+  for( unsigned int i = 0; i < sizeof( screenTextures ) / sizeof( screenTextures[ 0 ] ); i++ )
   {
-    gListTexture.setBlendMode( SDL_BLENDMODE_BLEND );
-
-    for( int i = 0; i < TOTAL_SCORES; i++ )
-    {
-      gListClips[ i ].x = 0;
-      gListClips[ i ].y = i * 100;
-      gListClips[ i ].w = 300;
-      gListClips[ i ].h = 100;
-    }
+    gDecodePool.add( screenPaths[ i ] );
+    textures.push_back( screenTextures[ i ] );
   }
 
-  if( !gSquareSpriteTexture.loadFromFile( "images/blocks.png" ) )
+  for( int i = 0; i < TOTAL_BG; i++ )
   {
-    printf( "Failed to load block sprite sheet texture!\n" );
-    success = false;
+    gDecodePool.add( "images/bg" + std::to_string( i + 1 ) + ".png" );
+    textures.push_back( &gBGTextures[ i ] );
   }
-  else
-  {
-    gSquareSpriteTexture.setBlendMode( SDL_BLENDMODE_BLEND );
 
-    for( int i = 0; i < SQUARE_SPRITE_TOTAL; i++ )
-    {
-      gSquareSpriteClips[ i ].x = i * Square::SQUARE_WIDTH;
-      gSquareSpriteClips[ i ].y = 0;
-      gSquareSpriteClips[ i ].w = Square::SQUARE_WIDTH;
-      gSquareSpriteClips[ i ].h = Square::SQUARE_HEIGHT;
-    }
-  }
+  Uint64 images = gStartupProfiler.begin();
+  gDecodePool.start();
 
-  if( !gHandBlackTexture.loadFromFile( "images/hands1.png" ) )
+  // The font is opened while the workers decode
+  Uint64 phase = gStartupProfiler.begin();
+  gFont = TTF_OpenFontRW( gAssetPack.openFile( "fonts/Krungthep.ttf" ), 1, lroundf( 25 * LTexture::getScale() ) );
+  gStartupProfiler.end( "font fonts/Krungthep.ttf", phase );
+  if( gFont == NULL )
   {
-    printf( "Failed to load black hand sheet texture!\n" );
+    printf( "Failed to load Krungthep font! SDL_ttf Error: %s\n", TTF_GetError() );
     success = false;
   }
-  else
-  {
-    gHandBlackTexture.setBlendMode( SDL_BLENDMODE_BLEND );
-  }
 
-  if( !gHandWhiteTexture.loadFromFile( "images/hands2.png" ) )
-  {
-    printf( "Failed to load white hand sheet texture!\n" );
-    success = false;
-  }
-  else
+  for( int job = gDecodePool.next(); job != -1; job = gDecodePool.next() )
   {
-    gHandWhiteTexture.setBlendMode( SDL_BLENDMODE_BLEND );
-
-    for( int i = 0; i < 5; i++ )
-    {
-      gHandClips[ i ].x = 0;
-      gHandClips[ i ].y = i * 275;
-      gHandClips[ i ].w = 850;
-      gHandClips[ i ].h = 275;
-    }
-  }
+    std::string path = gDecodePool.getPath( job );
+    DecodedImage& image = gDecodePool.getImage( job );
+    gStartupProfiler.add( "decode " + path, image.decodeStart, image.decodeTime );
 
-  for( int i = 0; i < TOTAL_BG; i++ )
-  {
-    std::string name = "images/bg" + std::to_string( i + 1 ) + ".png";
-    if( !gBGTextures[ i ].loadFromFile( name ) )
+    phase = gStartupProfiler.begin();
+    if( !textures[ job ]->loadFromDecoded( image, path ) )
     {
-      printf( "Failed to load background %d texture!\n", i + 1 );
+      printf( "Failed to load %s texture!\n", path.c_str() );
       success = false;
     }
+    gStartupProfiler.end( "upload " + path, phase );
   }
 
-  gFont = TTF_OpenFont( "fonts/Krungthep.ttf", 25 );
-  if( gFont == NULL )
-  {
-    printf( "Failed to load Krungthep font! SDL_ttf Error: %s\n", TTF_GetError() );
-    success = false;
-  }
+  gDecodePool.finish();
+  gStartupProfiler.end( "images", images );
 
-  gStartMusic = Mix_LoadWAV( "music/start.wav" );
-  if( gStartMusic == NULL )
+  gListTexture.setBlendMode( SDL_BLENDMODE_BLEND );
+  for( int i = 0; i < TOTAL_SCORES; i++ )
   {
-    printf( "Failed to load start music! SDL_mixer Error: %s\n", Mix_GetError() );
-    success = false;
+    gListClips[ i ].x = 0;
+    gListClips[ i ].y = i * 100;
+    gListClips[ i ].w = 300;
+    gListClips[ i ].h = 100;
   }
 
-  gScoreMusic = Mix_LoadWAV( "music/score.wav" );
-  if( gScoreMusic == NULL )
+  gSquareSpriteTexture.setBlendMode( SDL_BLENDMODE_BLEND );
+  for( int i = 0; i < SQUARE_SPRITE_TOTAL; i++ )
   {
-    printf( "Failed to load score music! SDL_mixer Error: %s\n", Mix_GetError() );
-    success = false;
+    gSquareSpriteClips[ i ].x = i * Square::SQUARE_WIDTH;
+    gSquareSpriteClips[ i ].y = 0;
+    gSquareSpriteClips[ i ].w = Square::SQUARE_WIDTH;
+    gSquareSpriteClips[ i ].h = Square::SQUARE_HEIGHT;
   }
 
-  gMoveSound = Mix_LoadWAV( "sounds/move.wav" );
-  if( gMoveSound == NULL )
+  phase = gStartupProfiler.begin();
+  if( gSquareSpriteTexture.getWidth() > 0 && !gPreviewCache.build() )
   {
-    printf( "Failed to load move sound! SDL_mixer Error: %s\n", Mix_GetError() );
+    printf( "Failed to build Tetromino previews!\n" );
     success = false;
   }
+  gStartupProfiler.end( "Tetromino previews", phase );
 
-  gHoldSound = Mix_LoadWAV( "sounds/hold.wav" );
-  if( gHoldSound == NULL )
+  gHandBlackTexture.setBlendMode( SDL_BLENDMODE_BLEND );
+  gHandWhiteTexture.setBlendMode( SDL_BLENDMODE_BLEND );
+  for( int i = 0; i < 5; i++ )
   {
-    printf( "Failed to load hold sound! SDL_mixer Error: %s\n", Mix_GetError() );
-    success = false;
+    gHandClips[ i ].x = 0;
+    gHandClips[ i ].y = i * 275;
+    gHandClips[ i ].w = 850;
+    gHandClips[ i ].h = 275;
   }
 
-  gLandSound = Mix_LoadWAV( "sounds/land.wav" );
-  if( gLandSound == NULL )
-  {
-    printf( "Failed to load land sound! SDL_Mixer Error: %s\n", Mix_GetError() );
-    success = false;
-  }
+  return success;
+}
 
-  gClearSound = Mix_LoadWAV( "sounds/clear.wav" );
-  if( gClearSound == NULL )
-  {
-    printf( "Failed to load clear sound! SDL_mixer Error: %s\n", Mix_GetError() );
-    success = false;
-  }
+bool loadMedia()
+{
+  bool success = true;
 
-  gTetrisSound = Mix_LoadWAV( "sounds/tetris.wav" );
-  if( gTetrisSound == NULL )
+  Uint64 phase = gStartupProfiler.begin();
+  if( !gScoreStore.open( SCORE_SNAPSHOT_PATH, SCORE_JOURNAL_PATH ) )
   {
-    printf( "Failed to load tetris sound! SDL_mixer Error: %s\n", Mix_GetError() );
+    printf( "Error: Unable to open score store %s!\n", SCORE_SNAPSHOT_PATH );
     success = false;
   }
+  gStartupProfiler.end( "score store", phase );
 
-  gGameOverSound = Mix_LoadWAV( "sounds/gameover.wav" );
-  if( gGameOverSound == NULL )
-  {
-    printf( "Failed to load game over sound! SDL_mixer Error: %s\n", Mix_GetError() );
-    success = false;
-  }
+  // Games are still played without stats, they are just missing from reports
+  phase = gStartupProfiler.begin();
+  gStatsStore.open( STATS_DIR, true );
+  gStartupProfiler.end( "stats store", phase );
 
-  for( int i = 0; i < TOTAL_BGM; i++ )
+  if( !loadScaledMedia() )
   {
-    gBGMusic[ i ] = NULL;
-    std::string name = "music/bgm" + std::to_string( i + 1 ) + ".wav";
-    gBGMusic[ i ] = Mix_LoadWAV( name.c_str() );
-    if( gBGMusic[ i ] == NULL )
-    {
-      printf( "Failed to load background music %d! SDL_mixer Error: %s\n", i + 1, Mix_GetError() );
-      success = false;
-    }
+    success = false;
   }
 
   return success;
 }
 
-void close()
+// Free everything loadScaledMedia created, along with text rendered in the font
+void freeScaledMedia()
 {
-  SDL_RWops* file = SDL_RWFromFile( "bin/scores.bin", "w+b" );
-  if( file != NULL )
-  {
-    for( int i = 0; i < TOTAL_SCORES; i++ )
-    {
-      if( gScores[ i ].name == "" )
-      {
-	strcpy( gScores[ i ].name, " " );
-      }
-      SDL_RWwrite( file, &gScores[ i ], sizeof( Score ), 1 );
-    }
-    
-    SDL_RWclose( file );
-  }
-  else
-  {
-    printf( "Error: Could not save file! SDL Error: %s\n", SDL_GetError() );
-  }
-
   gBlankBGTexture.free();
   gPressEnterTexture.free();
   gPlayBGTexture.free();
@@ -342,6 +343,7 @@ void close()
   gListTexture.free();
   gBlackTexture.free();
   gSquareSpriteTexture.free();
+  gPreviewCache.free();
   gHandBlackTexture.free();
   gHandWhiteTexture.free();
   gScoreTextTexture.free();
@@ -361,14 +363,31 @@ void close()
 
   gNewScoreTextTextures[ 0 ].free();
   gNewScoreTextTextures[ 1 ].free();
+  gFrameTimeTextTexture.free();
+  gCounterTextTexture.free();
 
   TTF_CloseFont( gFont );
   gFont = NULL;
+}
 
-  Mix_FreeChunk( gStartMusic );
+void close()
+{
+  // Fold the score journal into a snapshot, then wait until every queued write is on disk
+  gScoreStore.close();
+  gIOWorker.stop();
+
+  freeScaledMedia();
+
+  // Sounds may still be loading in the background
+  gAudioLoader.wait();
+
+  Mix_HaltMusic();
+  Mix_FreeMusic( gStartMusic );
   gStartMusic = NULL;
-  Mix_FreeChunk( gScoreMusic );
+  Mix_FreeMusic( gScoreMusic );
   gScoreMusic = NULL;
+  Mix_FreeMusic( gGameOverMusic );
+  gGameOverMusic = NULL;
   Mix_FreeChunk( gMoveSound );
   gMoveSound = NULL;
   Mix_FreeChunk( gHoldSound );
@@ -382,7 +401,7 @@ void close()
 
   for( int i = 0; i < TOTAL_BGM; i++ )
   {
-    Mix_FreeChunk( gBGMusic[ i ] );
+    Mix_FreeMusic( gBGMusic[ i ] );
     gBGMusic[ i ] = NULL;
   }
 
@@ -391,15 +410,303 @@ void close()
   gWindow = NULL;
   gRenderer = NULL;
 
+  gAudioDevice.close();
+  gAssetPack.close();
   Mix_Quit();
   TTF_Quit();
   IMG_Quit();
   SDL_Quit();
 }
 
-int main()
+// Rasterize images and text again once the window has changed scale
+bool rescaleMedia()
+{
+  float scale = getOutputScale();
+  if( fabsf( scale - LTexture::getScale() ) < 0.01f )
+  {
+    return false;
+  }
+
+  LTexture::setScale( scale );
+  freeScaledMedia();
+  View::forgetText();
+
+  if( !loadScaledMedia() )
+  {
+    printf( "Failed to load media at scale %.2f!\n", scale );
+  }
+
+  return true;
+}
+
+// Switch between a window and the whole desktop, remembered for later launches
+void toggleFullscreen( Config& config )
+{
+  bool fullscreen = ( SDL_GetWindowFlags( gWindow ) & SDL_WINDOW_FULLSCREEN ) != 0;
+
+  SDL_SetWindowFullscreen( gWindow, fullscreen ? 0 : SDL_WINDOW_FULLSCREEN_DESKTOP );
+
+  config.setInt( "fullscreen", fullscreen ? 0 : 1 );
+  config.save();
+}
+
+// Read pacing options from the command line
+void parseArguments( int argc, char* argv[], FramePacer& pacer, bool& showFrameTime, int& minimaps, int& minimapFocus, ExportOptions& exportOptions, bool& calibrate, bool& buildCache, Config& config )
+{
+  // Started through the tetpnc-render link, export the last recorded game
+  std::string name = argv[ 0 ];
+  if( name.size() >= 13 && name.compare( name.size() - 13, 13, "tetpnc-render" ) == 0 )
+  {
+    exportOptions.enabled = true;
+  }
+
+  for( int i = 1; i < argc; i++ )
+  {
+    std::string arg = argv[ i ];
+
+    if( arg == "--vsync" )
+    {
+      pacer.setMode( PACING_MODE_VSYNC, pacer.getFPSCap() );
+    }
+    else if( arg == "--fps" && i + 1 < argc )
+    {
+      pacer.setMode( PACING_MODE_CAPPED, atoi( argv[ ++i ] ) );
+    }
+    else if( arg == "--uncapped" )
+    {
+      pacer.setMode( PACING_MODE_UNCAPPED, pacer.getFPSCap() );
+    }
+    else if( arg == "--frame-time" )
+    {
+      showFrameTime = true;
+    }
+    else if( arg == "--null-render" )
+    {
+      gRenderQueue.setBackend( RENDER_BACKEND_NULL );
+    }
+    else if( arg == "--dirty-rects" )
+    {
+      gRenderQueue.setDirtyTracking( true );
+    }
+    else if( arg == "--minimaps" && i + 1 < argc )
+    {
+      minimaps = atoi( argv[ ++i ] );
+    }
+    else if( arg == "--minimap-focus" && i + 1 < argc )
+    {
+      minimapFocus = atoi( argv[ ++i ] );
+    }
+    else if( arg == "--fullscreen" )
+    {
+      config.setInt( "fullscreen", 1 );
+      config.save();
+    }
+    else if( arg == "--windowed" )
+    {
+      config.setInt( "fullscreen", 0 );
+      config.save();
+    }
+    else if( arg == "--audio-buffer" && i + 1 < argc )
+    {
+      config.setInt( "audio_buffer", atoi( argv[ ++i ] ) );
+      config.save();
+    }
+    else if( arg == "--loose-assets" )
+    {
+      gAssetPack.close();
+    }
+    else if( arg == "--decode-threads" && i + 1 < argc )
+    {
+      gDecodePool.setThreads( atoi( argv[ ++i ] ) );
+      gDecodePool.setReporting( true );
+    }
+    else if( arg == "--no-texture-cache" )
+    {
+      gTextureCache.setEnabled( false );
+    }
+    else if( arg == "--build-cache" )
+    {
+      buildCache = true;
+    }
+    else if( arg == "--profile-startup" )
+    {
+      gStartupProfiler.setEnabled( true );
+      gDecodePool.setReporting( true );
+    }
+    else if( arg == "--calibrate" )
+    {
+      calibrate = true;
+    }
+    else if( arg == "--render" && i + 1 < argc )
+    {
+      exportOptions.enabled = true;
+      exportOptions.recording = argv[ ++i ];
+    }
+    else if( arg == "--output" && i + 1 < argc )
+    {
+      exportOptions.output = argv[ ++i ];
+    }
+    else if( arg == "--format" && i + 1 < argc )
+    {
+      std::string format = argv[ ++i ];
+      exportOptions.format = format == "rgba" ? EXPORT_FORMAT_RGBA : EXPORT_FORMAT_Y4M;
+    }
+    else if( exportOptions.enabled && arg[ 0 ] != '-' )
+    {
+      exportOptions.recording = argv[ i ];
+    }
+    else
+    {
+      printf( "Unknown option %s\n", argv[ i ] );
+      printf( "Usage: tetpnc [--vsync | --fps N | --uncapped] [--frame-time] [--null-render] [--dirty-rects] [--minimaps N] [--minimap-focus N] [--calibrate] [--fullscreen | --windowed] [--audio-buffer N] [--loose-assets] [--decode-threads N] [--no-texture-cache] [--profile-startup]\n" );
+      printf( "       tetpnc --render FILE [--output PATH | -] [--format y4m | rgba]\n" );
+      printf( "       tetpnc --build-cache\n" );
+    }
+  }
+}
+
+// Draw measured frame times in the top left corner
+void renderFrameTime( FramePacer& pacer, FrameSnapshot& s, InputQueue& inputs, Uint32& lastRefresh )
+{
+  if( lastRefresh == 0 || SDL_GetTicks() - lastRefresh >= 500 )
+  {
+    float frameTime = pacer.getAverageFrameTime();
+
+    char text[ 128 ];
+    snprintf( text, sizeof( text ), "%.0f FPS %.1f ms max %.1f work %.1f cmds %d batches %d io %d write %.1f ms", frameTime > 0.0f ? 1000.0f / frameTime : 0.0f,
+	      frameTime, pacer.getMaxFrameTime(), pacer.getAverageWorkTime(), gRenderQueue.getCommandCount(), gRenderQueue.getBatchCount(),
+	      gIOWorker.getQueueDepth(), gIOWorker.getLatency() );
+
+    SDL_Color textColor = { 0, 0, 0 };
+    gFrameTimeTextTexture.loadFromRenderedText( text, textColor );
+
+    snprintf( text, sizeof( text ), "particles %d/%d update %.3f ms dropped %d dirty %d audio %d latency %.0f ms xruns %d lost %d", s.particles.count,
+	      PARTICLE_CAPACITY, s.particles.updateTime, s.particles.dropped, gRenderQueue.getDirtyRectCount(), gAudioDevice.getBufferSamples(),
+	      gAudioDevice.getLatency(), gAudioDevice.getUnderruns(), inputs.getDropped() );
+    gCounterTextTexture.loadFromRenderedText( text, textColor );
+
+    lastRefresh = SDL_GetTicks();
+  }
+
+  gRenderQueue.setLayer( RENDER_LAYER_DEBUG );
+  gFrameTimeTextTexture.render( 5, 5 );
+  gCounterTextTexture.render( 5, 5 + gFrameTimeTextTexture.getHeight() );
+}
+
+// Replay a recorded game offscreen, streaming one video frame per logic step
+bool exportRecording( ExportOptions& options, View** views )
 {
-  if( !init() )
+  Recording recording;
+  if( !recording.load( options.recording ) )
+  {
+    return false;
+  }
+
+  VideoExporter exporter;
+  if( !exporter.open( options.output, options.format ) )
+  {
+    return false;
+  }
+
+  TripleBuffer snapshots;
+  InputQueue inputs;
+  Simulation simulation( &snapshots, &inputs );
+  simulation.beginReplay( recording.getSeed() );
+
+  // The last step leaves the game over screen and would enter the score list
+  Uint32 steps = recording.getSteps() > 0 ? recording.getSteps() - 1 : 0;
+  int nextEvent = 0;
+  int stateSerial = -1;
+  bool success = true;
+  Uint64 start = SDL_GetPerformanceCounter();
+
+  while( success && simulation.getStep() < steps )
+  {
+    while( nextEvent < recording.getEventCount() && recording.getEvent( nextEvent ).step == simulation.getStep() )
+    {
+      inputs.push( recording.getEvent( nextEvent ).event );
+      nextEvent++;
+    }
+
+    // Game time moves by exactly one step per frame, however long it takes to draw
+    Timer::advanceClock();
+    if( !simulation.step() )
+    {
+      success = false;
+      break;
+    }
+
+    FrameSnapshot* s = snapshots.acquireLatest();
+    View* view = views[ s->state ];
+    if( view == NULL || s->state == GAME_STATE_SCORELIST )
+    {
+      break;
+    }
+
+    exporter.beginFrame();
+
+    if( s->stateSerial != stateSerial )
+    {
+      view->enter( *s );
+      stateSerial = s->stateSerial;
+    }
+    view->render( *s, 0.0f );
+
+    success = exporter.endFrame();
+  }
+
+  if( !exporter.close() )
+  {
+    success = false;
+  }
+
+  float seconds = (float)( SDL_GetPerformanceCounter() - start ) / SDL_GetPerformanceFrequency();
+  printf( "Exported %d frames (%.1f s of play) in %.2f s\n", exporter.getFrameCount(), (float)exporter.getFrameCount() / LOGIC_TICKS_PER_SECOND, seconds );
+
+  return success;
+}
+
+int main( int argc, char* argv[] )
+{
+  FramePacer pacer;
+  bool showFrameTime = false;
+  int minimaps = 0;
+  int minimapFocus = 0;
+  int exitCode = 0;
+
+  ExportOptions exportOptions;
+  exportOptions.enabled = false;
+  exportOptions.recording = RECORDING_PATH;
+  exportOptions.output = "-";
+  exportOptions.format = EXPORT_FORMAT_Y4M;
+
+  bool calibrate = false;
+  bool buildCache = false;
+
+  // Settings, scores, and recordings are written in the background from here on
+  gIOWorker.start();
+
+  Config config;
+  config.load( CONFIG_PATH );
+
+  // Without a pack, assets are read from the loose files
+  gAssetPack.open( ASSET_PACK_PATH );
+
+  parseArguments( argc, argv, pacer, showFrameTime, minimaps, minimapFocus, exportOptions, calibrate, buildCache, config );
+
+  // Exports run as fast as they can, never waiting on the display
+  if( exportOptions.enabled )
+  {
+    // Nothing printed while loading may end up in a video streamed to standard output
+    if( std::string( exportOptions.output ) == "-" )
+    {
+      VideoExporter::keepStandardOutput();
+    }
+
+    pacer.setMode( PACING_MODE_UNCAPPED, pacer.getFPSCap() );
+  }
+
+  if( !init( pacer.getMode(), exportOptions.enabled || buildCache, !buildCache, config, calibrate ) )
   {
     printf( "Failed to initialize!\n" );
   }
@@ -409,6 +716,11 @@ int main()
     {
       printf( "Failed to load media!\n" );
     }   
+    else if( buildCache )
+    {
+      // Loading the images was enough to fill the cache
+      printf( "Texture cache written to %s\n", TEXTURE_CACHE_DIR );
+    }
     else
     {
       bool quit = false;
@@ -494,206 +806,229 @@ int main()
 	gridSquares[ i ].setPosition( x, y );
       }
 
-      Square nextSquaresTop1[ 8 ];
-      for( int i = 0; i < 8; i++ )
-      {
-	int x = ( ( i % 4 ) * Square::SQUARE_WIDTH ) + nextAreaTop.x + ( nextAreaTop.w / 2 ) - ( Square::SQUARE_WIDTH * 2 );
-	int y = ( ( i / 4 ) * Square::SQUARE_HEIGHT ) + nextAreaTop.y + ( nextAreaTop.h / 2 ) - ( Square::SQUARE_HEIGHT * 2 );
-	nextSquaresTop1[ i ].setPosition( x, y );
-      }
+      SDL_Rect nextAreas[ NEXT_QUEUE_SIZE ];
+      nextAreas[ 0 ] = nextAreaTop;
+      nextAreas[ 1 ] = nextAreaMid;
+      nextAreas[ 2 ] = nextAreaBot;
 
-      Square nextSquaresTop2[ 6 ];
-      for( int i = 0; i < 6; i++ )
-      {
-	int x = ( ( i % 3 ) * Square::SQUARE_WIDTH ) + nextAreaTop.x + ( nextAreaTop.w / 2 ) - ( Square::SQUARE_WIDTH * 3 / 2 );
-	int y = ( ( i / 3 ) * Square::SQUARE_HEIGHT ) + nextAreaTop.y + ( nextAreaTop.h / 2 ) - ( Square::SQUARE_HEIGHT * 2 );
-	nextSquaresTop2[ i ].setPosition( x, y );
-      }
+      SDL_Rect startAreas[ 2 ];
+      startAreas[ 0 ] = startAreaL;
+      startAreas[ 1 ] = startAreaR;
 
-      Square nextSquaresMid1[ 8 ];
-      for( int i = 0; i < 8; i++ )
-      {
-	int x = ( ( i % 4 ) * Square::SQUARE_WIDTH ) + nextAreaMid.x + ( nextAreaMid.w / 2 ) - ( Square::SQUARE_WIDTH * 2 );
-	int y = ( ( i / 4 ) * Square::SQUARE_HEIGHT ) + nextAreaMid.y + ( nextAreaMid.h / 2 ) - ( Square::SQUARE_HEIGHT * 2 );
-	nextSquaresMid1[ i ].setPosition( x, y );
-      }
+      SDL_Rect textAreas[ 3 ];
+      textAreas[ 0 ] = scoreArea;
+      textAreas[ 1 ] = linesArea;
+      textAreas[ 2 ] = levelArea;
 
-      Square nextSquaresMid2[ 6 ];
-      for( int i = 0; i < 6; i++ )
+      Uint64 phase = gStartupProfiler.begin();
+      View* views[ GAME_STATE_ERROR ] = { NULL };
+      views[ GAME_STATE_INTRO ] = new IntroView( startAreas, listArea );
+      views[ GAME_STATE_PLAY ] = new PlayView( gridSquares, nextAreas, holdArea, textAreas );
+      views[ GAME_STATE_GAMEOVER ] = new GameOverView( gridSquares, yourScoreArea );
+      views[ GAME_STATE_SCORELIST ] = new ScoreListView( listArea );
+      gStartupProfiler.end( "views", phase );
+
+      // Spectator minimaps around the board, mirroring it until remote boards exist
+      Minimap minimap;
+      if( minimaps > 0 && minimap.build( minimaps ) )
       {
-	int x = ( ( i % 3 ) * Square::SQUARE_WIDTH ) + nextAreaMid.x + ( nextAreaMid.w / 2 ) - ( Square::SQUARE_WIDTH * 3 / 2 );
-	int y = ( ( i / 3 ) * Square::SQUARE_HEIGHT ) + nextAreaMid.y + ( nextAreaMid.h / 2 ) - ( Square::SQUARE_HEIGHT * 2 );
-	nextSquaresMid2[ i ].setPosition( x, y );
-      }
+	// Panels of the play background, labels and shadows included, that must stay visible
+	SDL_Rect hud[] = { gridArea, { 290, 50, 260, 460 }, { 85, 75, 140, 165 }, { 610, 75, 140, 365 }, { 75, 275, 150, 225 }, { 605, 450, 220, 80 } };
 
-      Square nextSquaresBot1[ 8 ];
-      for( int i = 0; i < 8; i++ )
-      {
-	int x = ( ( i % 4 ) * Square::SQUARE_WIDTH ) + nextAreaBot.x + ( nextAreaBot.w / 2 ) - ( Square::SQUARE_WIDTH * 2 );
-	int y = ( ( i / 4 ) * Square::SQUARE_HEIGHT ) + nextAreaBot.y + ( nextAreaBot.h / 2 ) - ( Square::SQUARE_HEIGHT * 2 );
-	nextSquaresBot1[ i ].setPosition( x, y );
-      }
+	SDL_Rect screen = { 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT };
+	minimap.layout( screen, hud, sizeof( hud ) / sizeof( hud[ 0 ] ), 2 );
 
-      Square nextSquaresBot2[ 6 ];
-      for( int i = 0; i < 6; i++ )
-      {
-	int x = ( ( i % 3 ) * Square::SQUARE_WIDTH ) + nextAreaBot.x + ( nextAreaBot.w / 2 ) - ( Square::SQUARE_WIDTH * 3 / 2 );
-	int y = ( ( i / 3 ) * Square::SQUARE_HEIGHT ) + nextAreaBot.y + ( nextAreaBot.h / 2 ) - ( Square::SQUARE_HEIGHT * 2 );
-	nextSquaresBot2[ i ].setPosition( x, y );
+	// Boards are numbered from 1 on the command line
+	if( minimapFocus > minimap.getBoardCount() )
+	{
+	  printf( "Minimap %d does not fit on screen, no board is focused\n", minimapFocus );
+	}
+	else if( minimapFocus > 0 )
+	{
+	  minimap.setFocus( minimapFocus - 1 );
+	}
       }
 
-      Square* nextSquares[ 6 ];
-      nextSquares[ 0 ] = nextSquaresTop1;
-      nextSquares[ 1 ] = nextSquaresTop2;
-      nextSquares[ 2 ] = nextSquaresMid1;
-      nextSquares[ 3 ] = nextSquaresMid2;
-      nextSquares[ 4 ] = nextSquaresBot1;
-      nextSquares[ 5 ] = nextSquaresBot2;
+      srand( time( NULL ) );
+      rand();
 
-      Square holdSquares1[ 8 ];
-      for( int i = 0; i < 8; i++ )
-      {
-	int x = ( ( i % 4 ) * Square::SQUARE_WIDTH ) + holdArea.x + ( holdArea.w / 2 ) - ( Square::SQUARE_WIDTH * 2 );
-	int y = ( ( i / 4 ) * Square::SQUARE_HEIGHT ) + holdArea.y + ( holdArea.h / 2 ) - ( Square::SQUARE_HEIGHT * 2 );
-	holdSquares1[ i ].setPosition( x, y );
-      }
+      TripleBuffer snapshots;
+      InputQueue inputs;
+      phase = gStartupProfiler.begin();
+      Simulation simulation( &snapshots, &inputs );
+      gStartupProfiler.end( "simulation and Intro state", phase );
 
-      Square holdSquares2[ 6 ];
-      for( int i = 0; i < 6; i++ )
-      {
-	int x = ( ( i % 3 ) * Square::SQUARE_WIDTH ) + holdArea.x + ( holdArea.w / 2 ) - ( Square::SQUARE_WIDTH * 3 / 2 );
-	int y = ( ( i / 3 ) * Square::SQUARE_HEIGHT ) + holdArea.y + ( holdArea.h / 2 ) - ( Square::SQUARE_HEIGHT * 2 );
-	holdSquares2[ i ].setPosition( x, y );
-      }
+      Recording recording;
+      simulation.setRecording( &recording );
 
-      Square* holdSquares[ 2 ];
-      holdSquares[ 0 ] = holdSquares1;
-      holdSquares[ 1 ] = holdSquares2;
+      int stateSerial = -1;
+      int preparedSerial = -1;
+      Uint32 frameTimeRefresh = 0;
 
-      Square startSquares1[ 8 ];
-      for( int i = 0; i < 8; i++ )
+      if( exportOptions.enabled )
       {
-	int x = ( ( i % 4 ) * Square::SQUARE_WIDTH ) + startAreaL.x + ( startAreaL.w / 2 ) - ( Square::SQUARE_WIDTH * 2 );
-	int y = ( ( i / 4 ) * Square::SQUARE_HEIGHT ) + startAreaL.y + ( startAreaL.h / 2 ) - ( Square::SQUARE_HEIGHT * 2 );
-	startSquares1[ i ].setPosition( x, y );
-      }
+	Mix_Volume( -1, 0 );
+	Mix_VolumeMusic( 0 );
 
-      Square startSquares2[ 6 ];
-      for( int i = 0; i < 6; i++ )
-      {
-	int x = ( ( i % 3 ) * Square::SQUARE_WIDTH ) + startAreaL.x + ( startAreaL.w / 2 ) - ( Square::SQUARE_WIDTH * 3 / 2 );
-	int y = ( ( i / 3 ) * Square::SQUARE_HEIGHT ) + startAreaL.y + ( startAreaL.h / 2 ) - ( Square::SQUARE_HEIGHT * 2 );
-	startSquares2[ i ].setPosition( x, y );
+	if( !exportRecording( exportOptions, views ) )
+	{
+	  exitCode = 1;
+	}
+	quit = true;
       }
-
-      Square startSquares3[ 8 ];
-      for( int i = 0; i < 8; i++ )
+      else
       {
-	int x = ( ( i % 4 ) * Square::SQUARE_WIDTH ) + startAreaR.x + ( startAreaR.w / 2 ) - ( Square::SQUARE_WIDTH * 2 );
-	int y = ( ( i / 4 ) * Square::SQUARE_HEIGHT ) + startAreaR.y + ( startAreaR.h / 2 ) - ( Square::SQUARE_HEIGHT * 2 );
-	startSquares3[ i ].setPosition( x, y );
-      }
+	// Sounds and music keep loading while the intro plays
+	phase = gStartupProfiler.begin();
+	gAudioLoader.start();
+	gStartupProfiler.end( "audio loader start", phase );
 
-      Square startSquares4[ 6 ];
-      for( int i = 0; i < 6; i++ )
-      {
-	int x = ( ( i % 3 ) * Square::SQUARE_WIDTH ) + startAreaR.x + ( startAreaR.w / 2 ) - ( Square::SQUARE_WIDTH * 3 / 2 );
-	int y = ( ( i / 3 ) * Square::SQUARE_HEIGHT ) + startAreaR.y + ( startAreaR.h / 2 ) - ( Square::SQUARE_HEIGHT * 2 );
-	startSquares4[ i ].setPosition( x, y );
+	phase = gStartupProfiler.begin();
+	if( !simulation.start() )
+	{
+	  quit = true;
+	}
+	gStartupProfiler.end( "simulation thread start", phase );
       }
 
-      Square* startSquares[ 4 ];
-      startSquares[ 0 ] = startSquares1;
-      startSquares[ 1 ] = startSquares2;
-      startSquares[ 2 ] = startSquares3;
-      startSquares[ 3 ] = startSquares4;
-
-      SDL_Rect textAreas[ 3 ];
-      textAreas[ 0 ] = scoreArea;
-      textAreas[ 1 ] = linesArea;
-      textAreas[ 2 ] = levelArea;
-
-      Stats stats;
-
-      GameState* g = new Intro( startSquares, listArea );
-
-      srand( time( NULL ) );
-      rand();
-  
-      /*
-      const int SCREEN_FPS = 60;
-      const int SCREEN_TICKS_PER_FRAME = 1000 / SCREEN_FPS;
-      int startTime = SDL_GetTicks();
-      int totalTime = 0;
-      */
-
       while( !quit )
       {
+	pacer.beginFrame();
+	Uint64 frame = gStartupProfiler.begin();
+
 	while( SDL_PollEvent( &e ) != 0 )
 	{
+	  // Whatever was on screen may be gone after any change to the window
+	  if( e.type == SDL_WINDOWEVENT || e.type == SDL_RENDER_TARGETS_RESET )
+	  {
+	    gRenderQueue.invalidate();
+	  }
+
 	  if( e.type == SDL_QUIT )
 	  {
 	    quit = true;
 	  }
+	  // Debug keys belong to the window, not the game
+	  else if( ( e.type == SDL_KEYDOWN || e.type == SDL_KEYUP ) && ( e.key.keysym.sym == SDLK_F3 || e.key.keysym.sym == SDLK_F11 ) )
+	  {
+	    if( e.type == SDL_KEYDOWN && e.key.repeat == 0 && e.key.keysym.sym == SDLK_F3 )
+	    {
+	      showFrameTime = !showFrameTime;
+	    }
+	    else if( e.type == SDL_KEYDOWN && e.key.repeat == 0 && e.key.keysym.sym == SDLK_F11 )
+	    {
+	      toggleFullscreen( config );
+	    }
+	  }
+	  // Views rebuild their text when they enter again
+	  else if( e.type == SDL_WINDOWEVENT && e.window.event == SDL_WINDOWEVENT_SIZE_CHANGED && rescaleMedia() )
+	  {
+	    stateSerial = -1;
+	    preparedSerial = -1;
+	    frameTimeRefresh = 0;
+	  }
+	  // Render target contents are lost when the device resets
+	  else if( e.type == SDL_RENDER_TARGETS_RESET && !gPreviewCache.build() )
+	  {
+	    printf( "Failed to rebuild Tetromino previews!\n" );
+	  }
+	  // The states only read keys and text, anything else would crowd them out
+	  else if( e.type == SDL_KEYDOWN || e.type == SDL_KEYUP || e.type == SDL_TEXTINPUT )
+	  {
+	    inputs.push( e );
+	  }
+	}
+
+	FrameSnapshot* s = snapshots.acquireLatest();
 
-	  g->handleEvent( e );
+	if( s->state == GAME_STATE_ERROR )
+	{
+	  exitCode = 1;
+	  break;
 	}
 
-	g->logic();
+	// Dirty rect frames are cleared by the render queue, only where they changed
+	if( !gRenderQueue.getDirtyTracking() )
+	{
+	  SDL_SetRenderDrawColor( gRenderer, 0xFF, 0xFF, 0xFF, 0xFF );
+	  SDL_RenderClear( gRenderer );
+	}
 
-	SDL_SetRenderDrawColor( gRenderer, 0xFF, 0xFF, 0xFF, 0xFF );
-	SDL_RenderClear( gRenderer );
+	View* view = views[ s->state ];
+	if( view != NULL )
+	{
+	  if( s->stateSerial != stateSerial )
+	  {
+	    phase = gStartupProfiler.begin();
+	    view->enter( *s );
+	    stateSerial = s->stateSerial;
+	    gStartupProfiler.end( "view enter and text textures", phase );
+	  }
+	  // A frame later, get the screen that usually follows ready
+	  else if( s->stateSerial != preparedSerial )
+	  {
+	    View* next = views[ EXPECTED_NEXT_STATES[ s->state ] ];
+	    if( next != NULL )
+	    {
+	      next->prepare( *s );
+	    }
+	    preparedSerial = s->stateSerial;
+	  }
 
-	g->render();
+	  // Fraction of a logic step passed since the snapshot was published
+	  float interpolation = (float)( SDL_GetPerformanceCounter() - s->publishTime ) * LOGIC_TICKS_PER_SECOND / SDL_GetPerformanceFrequency();
+	  if( interpolation > 1.0f )
+	  {
+	    interpolation = 1.0f;
+	  }
 
-	SDL_RenderPresent( gRenderer );
+	  view->render( *s, interpolation );
+	}
 
-	GameStateFlag nextState = g->getNextState();
+	if( s->state == GAME_STATE_PLAY && minimap.getBoardCount() > 0 )
+	{
+	  for( int i = 0; i < minimap.getBoardCount(); i++ )
+	  {
+	    minimap.update( i, s->squareSprites );
+	  }
+	  minimap.render();
+	}
 
-	switch( nextState )
+	if( showFrameTime )
 	{
-	  case GAME_STATE_NULL:
-	    break;
-
-	  case GAME_STATE_INTRO:
-	    delete g;
-	    g = new Intro( startSquares, listArea );
-	    break;
-
-	  case GAME_STATE_PLAY:
-	    delete g;
-	    g = new Play( &stats, gridSquares, nextSquares, holdSquares, textAreas );
-	    break;
-
-	  case GAME_STATE_GAMEOVER:
-	    delete g;
-	    g = new GameOver( &stats, gridSquares, yourScoreArea );
-	    break;
-
-	  case GAME_STATE_SCORELIST:
-	    delete g;
-	    g = new ScoreList( stats.score, listArea );
-	    break;
-
-	  case GAME_STATE_ERROR:
-	    delete g;
-	    printf( "Error found. Exiting game\n" );
-	    return 1;
+	  renderFrameTime( pacer, *s, inputs, frameTimeRefresh );
 	}
-	
-	/*
-	totalTime = SDL_GetTicks() - startTime;
-	if( totalTime < SCREEN_TICKS_PER_FRAME )
+
+	gRenderQueue.submit();
+	gRenderQueue.present();
+
+	if( s->state == GAME_STATE_INTRO && gStartupProfiler.isEnabled() )
 	{
-	  SDL_Delay( SCREEN_TICKS_PER_FRAME - totalTime );
+	  gStartupProfiler.end( "first intro frame", frame );
+	  gStartupProfiler.finish();
 	}
-	*/
+
+	pacer.endFrame();
+      }
+
+      simulation.stop();
+
+      // Keep a buffer that had to grow for the next launch
+      if( gAudioDevice.getBufferSamples() > config.getInt( "audio_buffer", AUDIO_BUFFER_SAMPLES ) )
+      {
+	config.setInt( "audio_buffer", gAudioDevice.getBufferSamples() );
+	config.save();
+      }
+
+      for( int i = 0; i < GAME_STATE_ERROR; i++ )
+      {
+	delete views[ i ];
       }
 
-      delete g;
+      minimap.free();
     }
   }
 
   close();
-  return 0;
-}
+  return exitCode;
+}
\ No newline at end of file
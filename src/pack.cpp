@@ -0,0 +1,33 @@
+#define SDL_MAIN_HANDLED
+
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "constants.h"
+#include "AssetPack/AssetPack.h"
+
+// Build step packing the game's asset files into one archive
+int main( int argc, char* argv[] )
+{
+  if( argc < 2 )
+  {
+    printf( "Usage: tetpnc-pack OUTPUT FILE...\n" );
+    return 1;
+  }
+
+  std::vector<std::string> files;
+  for( int i = 2; i < argc; i++ )
+  {
+    files.push_back( argv[ i ] );
+  }
+
+  if( !AssetPack::write( argv[ 1 ], files ) )
+  {
+    return 1;
+  }
+
+  printf( "Packed %d files into %s\n", (int)files.size(), argv[ 1 ] );
+  return 0;
+}
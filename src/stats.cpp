@@ -0,0 +1,302 @@
+#define SDL_MAIN_HANDLED
+
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "constants.h"
+#include "StatsStore/StatsStore.h"
+
+// A value reported per game: a column, optionally divided by another and scaled
+struct Metric
+{
+  std::string name;
+  int column;
+  int divisor;
+  double scale;
+  bool skipZero;
+};
+
+// Metric by name, either a raw column or one worked out from several
+static bool findMetric( std::string name, Metric& metric )
+{
+  metric.name = name;
+  metric.column = -1;
+  metric.divisor = -1;
+  metric.scale = 1.0;
+  metric.skipZero = false;
+
+  int level = 0;
+  int end = 0;
+  if( name == "minutes" )
+  {
+    metric.column = STATS_COLUMN_STEPS;
+    metric.scale = 1.0 / ( 60.0 * LOGIC_TICKS_PER_SECOND );
+  }
+  else if( name == "pieces_per_second" )
+  {
+    metric.column = STATS_COLUMN_PIECES;
+    metric.divisor = STATS_COLUMN_STEPS;
+    metric.scale = LOGIC_TICKS_PER_SECOND;
+  }
+  else if( name == "keys_per_piece" )
+  {
+    metric.column = STATS_COLUMN_KEYS;
+    metric.divisor = STATS_COLUMN_PIECES;
+  }
+  else if( sscanf( name.c_str(), "level%d_seconds%n", &level, &end ) == 1 && end == (int)name.size() && level >= 1 && level <= STATS_TRACKED_LEVELS )
+  {
+    // Only games that reached the level
+    metric.column = STATS_COLUMN_LEVEL_STEPS + level - 1;
+    metric.scale = 1.0 / LOGIC_TICKS_PER_SECOND;
+    metric.skipZero = true;
+  }
+  else
+  {
+    metric.column = StatsStore::findColumn( name );
+  }
+
+  return metric.column >= 0;
+}
+
+// Value of a metric for one game, false when the game has none
+static bool getValue( Metric& metric, const Uint32* values, const Uint32* divisors, int row, double& value )
+{
+  if( metric.skipZero && values[ row ] == 0 )
+  {
+    return false;
+  }
+
+  if( divisors != NULL )
+  {
+    if( divisors[ row ] == 0 )
+    {
+      return false;
+    }
+
+    value = metric.scale * values[ row ] / divisors[ row ];
+  }
+  else
+  {
+    value = metric.scale * values[ row ];
+  }
+
+  return true;
+}
+
+// Value at a share of the way through sorted values, by nearest rank
+static double percentile( std::vector<double>& values, double share )
+{
+  size_t rank = (size_t)( share * values.size() + 0.999999 );
+  size_t index = rank > 0 ? rank - 1 : 0;
+
+  std::nth_element( values.begin(), values.begin() + index, values.end() );
+  return values[ index ];
+}
+
+// Mean and spread of each metric over every game
+static void reportSummary( StatsStore& store, std::vector<Metric>& metrics )
+{
+  printf( "%-20s %10s %12s %12s %12s %12s %12s\n", "metric", "games", "mean", "p50", "p90", "p99", "max" );
+
+  std::vector<double> values;
+  for( size_t m = 0; m < metrics.size(); m++ )
+  {
+    const Uint32* column = store.getColumn( (StatsColumn)metrics[ m ].column );
+    const Uint32* divisors = metrics[ m ].divisor >= 0 ? store.getColumn( (StatsColumn)metrics[ m ].divisor ) : NULL;
+    if( column == NULL || ( metrics[ m ].divisor >= 0 && divisors == NULL ) )
+    {
+      continue;
+    }
+
+    values.clear();
+    double sum = 0.0;
+    double max = 0.0;
+    for( int row = 0; row < store.getRows(); row++ )
+    {
+      double value;
+      if( getValue( metrics[ m ], column, divisors, row, value ) )
+      {
+	values.push_back( value );
+	sum += value;
+	max = std::max( max, value );
+      }
+    }
+
+    if( values.empty() )
+    {
+      continue;
+    }
+
+    double mean = sum / values.size();
+    double p50 = percentile( values, 0.50 );
+    double p90 = percentile( values, 0.90 );
+    double p99 = percentile( values, 0.99 );
+    printf( "%-20s %10d %12.2f %12.2f %12.2f %12.2f %12.2f\n", metrics[ m ].name.c_str(), (int)values.size(), mean, p50, p90, p99, max );
+  }
+}
+
+// Games and the mean of each metric per UTC day
+static void reportDaily( StatsStore& store, std::vector<Metric>& metrics )
+{
+  const Uint32* ended = store.getColumn( STATS_COLUMN_ENDED );
+  if( ended == NULL )
+  {
+    return;
+  }
+
+  // Per day: games, then a sum and a count for each metric
+  std::map<Uint32, std::vector<double> > days;
+  for( int row = 0; row < store.getRows(); row++ )
+  {
+    std::vector<double>& day = days[ ended[ row ] / 86400 ];
+    if( day.empty() )
+    {
+      day.resize( 1 + 2 * metrics.size(), 0.0 );
+    }
+    day[ 0 ] += 1.0;
+  }
+
+  // One metric at a time, so only its columns are read
+  for( size_t m = 0; m < metrics.size(); m++ )
+  {
+    const Uint32* column = store.getColumn( (StatsColumn)metrics[ m ].column );
+    const Uint32* divisors = metrics[ m ].divisor >= 0 ? store.getColumn( (StatsColumn)metrics[ m ].divisor ) : NULL;
+    if( column == NULL || ( metrics[ m ].divisor >= 0 && divisors == NULL ) )
+    {
+      continue;
+    }
+
+    std::map<Uint32, std::vector<double> >::iterator day = days.end();
+    for( int row = 0; row < store.getRows(); row++ )
+    {
+      double value;
+      if( getValue( metrics[ m ], column, divisors, row, value ) )
+      {
+	// Games are appended in the order they end, so the day rarely changes
+	if( day == days.end() || day->first != ended[ row ] / 86400 )
+	{
+	  day = days.find( ended[ row ] / 86400 );
+	}
+	day->second[ 1 + 2 * m ] += value;
+	day->second[ 2 + 2 * m ] += 1.0;
+      }
+    }
+  }
+
+  printf( "%-10s %8s", "day", "games" );
+  for( size_t m = 0; m < metrics.size(); m++ )
+  {
+    printf( " %*s", (int)std::max( metrics[ m ].name.size(), (size_t)10 ), metrics[ m ].name.c_str() );
+  }
+  printf( "\n" );
+
+  for( std::map<Uint32, std::vector<double> >::iterator it = days.begin(); it != days.end(); ++it )
+  {
+    time_t start = (time_t)it->first * 86400;
+    char date[ 16 ];
+    strftime( date, sizeof( date ), "%Y-%m-%d", gmtime( &start ) );
+
+    printf( "%-10s %8.0f", date, it->second[ 0 ] );
+    for( size_t m = 0; m < metrics.size(); m++ )
+    {
+      int width = std::max( metrics[ m ].name.size(), (size_t)10 );
+      if( it->second[ 2 + 2 * m ] > 0.0 )
+      {
+	printf( " %*.2f", width, it->second[ 1 + 2 * m ] / it->second[ 2 + 2 * m ] );
+      }
+      else
+      {
+	printf( " %*s", width, "-" );
+      }
+    }
+    printf( "\n" );
+  }
+}
+
+// Report tool reading the per-game stats columns the game appends to
+int main( int argc, char* argv[] )
+{
+  std::string directory = STATS_DIR;
+  bool daily = false;
+  std::vector<Metric> metrics;
+
+  for( int i = 1; i < argc; i++ )
+  {
+    Metric metric;
+    if( strcmp( argv[ i ], "--dir" ) == 0 && i + 1 < argc )
+    {
+      directory = argv[ ++i ];
+    }
+    else if( strcmp( argv[ i ], "--daily" ) == 0 )
+    {
+      daily = true;
+    }
+    else if( argv[ i ][ 0 ] != '-' && findMetric( argv[ i ], metric ) )
+    {
+      metrics.push_back( metric );
+    }
+    else
+    {
+      printf( "Usage: tetpnc-stats [--dir DIR] [--daily] [METRIC...]\n" );
+      printf( "Metrics: minutes pieces_per_second keys_per_piece levelNN_seconds" );
+      for( int c = 0; c < STATS_COLUMN_TOTAL; c++ )
+      {
+	printf( " %s", StatsStore::getColumnName( c ).c_str() );
+      }
+      printf( "\n" );
+      return 1;
+    }
+  }
+
+  if( metrics.empty() )
+  {
+    const char* defaults[] = { "score", "lines", "level", "minutes", "pieces_per_second", "keys_per_piece", "holds", "singles", "doubles", "triples", "tetrises" };
+    for( size_t i = 0; i < sizeof( defaults ) / sizeof( defaults[ 0 ] ); i++ )
+    {
+      Metric metric;
+      findMetric( defaults[ i ], metric );
+      metrics.push_back( metric );
+    }
+
+    // Daily reports stay narrow without the time spent on each level
+    for( int level = 1; level <= STATS_TRACKED_LEVELS && !daily; level++ )
+    {
+      char name[ 32 ];
+      snprintf( name, sizeof( name ), "level%02d_seconds", level );
+
+      Metric metric;
+      findMetric( name, metric );
+      metrics.push_back( metric );
+    }
+  }
+
+  StatsStore store;
+  // Metrics whose columns are missing or damaged are left out of the report
+  if( !store.open( directory, false ) )
+  {
+    printf( "Warning: %s does not hold a complete set of stats columns\n", directory.c_str() );
+  }
+
+  printf( "%d games in %s\n", store.getRows(), directory.c_str() );
+  if( store.getRows() == 0 )
+  {
+    return 0;
+  }
+
+  if( daily )
+  {
+    reportDaily( store, metrics );
+  }
+  else
+  {
+    reportSummary( store, metrics );
+  }
+
+  return 0;
+}
@@ -2,8 +2,13 @@
 
 #include "../constants.h"
 #include "../LTexture/LTexture.h"
+#include "../RenderQueue/RenderQueue.h"
+#include "../PreviewCache/PreviewCache.h"
 #include "textures.h"
 
+// Draw commands recorded by LTexture::render
+RenderQueue gRenderQueue;
+
 // Menu/Gameplay textures
 LTexture gBlankBGTexture;
 LTexture gPressEnterTexture;
@@ -30,6 +35,9 @@ SDL_Rect gListClips[ TOTAL_SCORES ];
 LTexture gSquareSpriteTexture;
 SDL_Rect gSquareSpriteClips[ SQUARE_SPRITE_TOTAL ];
 
+// Pre-rendered Tetromino previews
+PreviewCache gPreviewCache;
+
 // Text textures
 LTexture gScoreTextTexture;
 LTexture gLinesTextTexture;
@@ -37,3 +45,7 @@ LTexture gLevelTextTexture;
 LTexture gYourScoreTextTexture;
 LTexture gListTextTextures[ 2 * TOTAL_SCORES ];
 LTexture gNewScoreTextTextures[ 2 ];
+
+// Debug readout textures
+LTexture gFrameTimeTextTexture;
+LTexture gCounterTextTexture;
@@ -5,6 +5,11 @@
 
 #include "../constants.h"
 #include "../LTexture/LTexture.h"
+#include "../RenderQueue/RenderQueue.h"
+#include "../PreviewCache/PreviewCache.h"
+
+// Draw commands recorded by LTexture::render
+extern RenderQueue gRenderQueue;
 
 // Menu/Gameplay textures
 extern LTexture gBlankBGTexture;
@@ -32,6 +37,9 @@ extern SDL_Rect gListClips[ TOTAL_SCORES ];
 extern LTexture gSquareSpriteTexture;
 extern SDL_Rect gSquareSpriteClips[ SQUARE_SPRITE_TOTAL ];
 
+// Pre-rendered Tetromino previews
+extern PreviewCache gPreviewCache;
+
 // Text textures
 extern LTexture gScoreTextTexture;
 extern LTexture gLinesTextTexture;
@@ -40,4 +48,8 @@ extern LTexture gYourScoreTextTexture;
 extern LTexture gListTextTextures[ 2 * TOTAL_SCORES ];
 extern LTexture gNewScoreTextTextures[ 2 ];
 
+// Debug readout textures
+extern LTexture gFrameTimeTextTexture;
+extern LTexture gCounterTextTexture;
+
 #endif